@@ -163,6 +163,7 @@ struct AChunk {
     struct {
       struct {
         uint8_t is_hugetlb_ : 1;
+        uint8_t is_thp_ : 1; // advised as transparent huge page
       };
     };
   };
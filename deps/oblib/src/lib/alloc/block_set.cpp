@@ -17,6 +17,7 @@
 #include "lib/ob_define.h"
 #include "lib/alloc/ob_tenant_ctx_allocator.h"
 #include "lib/alloc/ob_malloc_callback.h"
+#include "lib/resource/achunk_mgr.h"
 
 using namespace oceanbase;
 using namespace oceanbase::lib;
@@ -402,6 +403,9 @@ int64_t BlockSet::sync_wash(int64_t wash_size)
         if (chunk->is_hugetlb_) {
           _OB_LOG(DEBUG, "cannot be applied to Huge TLB pages");
           has_ignore = true;
+        } else if (!CHUNK_MGR.demote_thp(chunk)) {
+          _OB_LOG(DEBUG, "cannot demote transparent huge page chunk");
+          has_ignore = true;
         } else {
         #if MEMCHK_LEVEL >= 1
           abort_unless(!block->in_use_ && !block->is_washed_);
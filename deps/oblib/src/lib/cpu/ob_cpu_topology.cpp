@@ -15,7 +15,9 @@
 #include <stdio.h>
 #include <string.h>
 #include <pthread.h>
+#include <sched.h>
 #include "lib/ob_define.h"
+#include "lib/oblog/ob_log.h"
 
 using namespace oceanbase::common;
 
@@ -26,6 +28,159 @@ int64_t __attribute__((weak)) get_cpu_count()
 {
   return get_cpu_num();
 }
+
+// parse a linux cpu list like "0-31,64-95" into cpu_set
+static void parse_cpu_list(const char *list, cpu_set_t *cpu_set)
+{
+  const char *p = list;
+  while (NULL != p && '\0' != *p && '\n' != *p) {
+    char *end = NULL;
+    int64_t begin_id = strtol(p, &end, 10);
+    int64_t end_id = begin_id;
+    if (end == p) {
+      break;
+    } else if ('-' == *end) {
+      p = end + 1;
+      end_id = strtol(p, &end, 10);
+    }
+    for (int64_t i = begin_id; i <= end_id && i >= 0; ++i) {
+      if (i < CPU_SETSIZE) {
+        CPU_SET(i, cpu_set);
+      }
+    }
+    p = (',' == *end) ? end + 1 : end;
+  }
+}
+
+static int read_sys_file(const char *path, char *buf, const int64_t buf_len)
+{
+  int ret = OB_SUCCESS;
+  FILE *file = fopen(path, "r");
+  if (NULL == file) {
+    ret = OB_FILE_NOT_EXIST;
+  } else {
+    if (NULL == fgets(buf, static_cast<int>(buf_len), file)) {
+      ret = OB_IO_ERROR;
+    }
+    fclose(file);
+  }
+  return ret;
+}
+
+// node ids of /sys/devices/system/node/online, they may have holes
+static int read_online_numa_nodes(cpu_set_t &node_set)
+{
+  int ret = OB_SUCCESS;
+  char buf[256] = {0};
+  CPU_ZERO(&node_set);
+  if (OB_FAIL(read_sys_file("/sys/devices/system/node/online", buf, sizeof(buf)))) {
+    // no numa topology
+  } else {
+    parse_cpu_list(buf, &node_set);
+  }
+  return ret;
+}
+
+static int read_numa_node_cpus(const int64_t node_id, cpu_set_t &cpu_set)
+{
+  int ret = OB_SUCCESS;
+  char path[128] = {0};
+  char buf[4096] = {0};
+  CPU_ZERO(&cpu_set);
+  if (OB_UNLIKELY(node_id < 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    LIB_LOG(WARN, "invalid numa node", K(ret), K(node_id));
+  } else if (OB_UNLIKELY(0 >= snprintf(path, sizeof(path), "/sys/devices/system/node/node%ld/cpulist", node_id))) {
+    ret = OB_ERR_UNEXPECTED;
+    LIB_LOG(WARN, "fail to build cpulist path", K(ret), K(node_id));
+  } else if (OB_FAIL(read_sys_file(path, buf, sizeof(buf)))) {
+    LIB_LOG(WARN, "fail to read numa node cpulist", K(ret), K(node_id));
+  } else {
+    parse_cpu_list(buf, &cpu_set);
+  }
+  return ret;
+}
+
+int64_t get_numa_node_count()
+{
+  int64_t node_cnt = 0;
+  cpu_set_t node_set;
+  if (OB_SUCCESS == read_online_numa_nodes(node_set)) {
+    node_cnt = CPU_COUNT(&node_set);
+  }
+  return node_cnt;
+}
+
+int get_numa_node_id(const int64_t idx, int64_t &node_id)
+{
+  int ret = OB_SUCCESS;
+  cpu_set_t node_set;
+  node_id = -1;
+  if (OB_UNLIKELY(idx < 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    LIB_LOG(WARN, "invalid numa node index", K(ret), K(idx));
+  } else if (OB_FAIL(read_online_numa_nodes(node_set))) {
+    LIB_LOG(WARN, "fail to read online numa nodes", K(ret));
+  } else {
+    for (int64_t i = 0, cnt = 0; -1 == node_id && i < CPU_SETSIZE; ++i) {
+      if (CPU_ISSET(i, &node_set) && cnt++ == idx) {
+        node_id = i;
+      }
+    }
+    if (-1 == node_id) {
+      ret = OB_ENTRY_NOT_EXIST;
+      LIB_LOG(WARN, "numa node index out of range", K(ret), K(idx));
+    }
+  }
+  return ret;
+}
+
+int64_t get_numa_node_cpu_count(const int64_t node_id)
+{
+  int64_t cpu_cnt = 0;
+  cpu_set_t cpu_set;
+  if (OB_SUCCESS == read_numa_node_cpus(node_id, cpu_set)) {
+    cpu_cnt = CPU_COUNT(&cpu_set);
+  }
+  return cpu_cnt;
+}
+
+int bind_thread_to_numa_node(const int64_t node_id)
+{
+  int ret = OB_SUCCESS;
+  cpu_set_t cpu_set;
+  if (OB_FAIL(read_numa_node_cpus(node_id, cpu_set))) {
+    LIB_LOG(WARN, "fail to read numa node cpus", K(ret), K(node_id));
+  } else if (OB_UNLIKELY(0 == CPU_COUNT(&cpu_set))) {
+    ret = OB_ERR_UNEXPECTED;
+    LIB_LOG(WARN, "numa node has no cpu", K(ret), K(node_id));
+  } else if (0 != pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set)) {
+    ret = OB_ERR_SYS;
+    LIB_LOG(WARN, "fail to set thread affinity", K(ret), K(node_id), K(errno));
+  }
+  return ret;
+}
+
+int get_thread_affinity(cpu_set_t &cpu_set)
+{
+  int ret = OB_SUCCESS;
+  CPU_ZERO(&cpu_set);
+  if (0 != sched_getaffinity(0, sizeof(cpu_set), &cpu_set)) {
+    ret = OB_ERR_SYS;
+    LIB_LOG(WARN, "fail to get thread affinity", K(ret), K(errno));
+  }
+  return ret;
+}
+
+int set_thread_affinity(const pid_t tid, const cpu_set_t &cpu_set)
+{
+  int ret = OB_SUCCESS;
+  if (0 != sched_setaffinity(tid, sizeof(cpu_set), &cpu_set)) {
+    ret = OB_ERR_SYS;
+    LIB_LOG(WARN, "fail to set thread affinity", K(ret), K(tid), K(errno));
+  }
+  return ret;
+}
 } // common
 } // oceanbase
 
@@ -14,6 +14,8 @@
 #define OCEANBASE_LIB_OB_CPU_TOPOLOGY_
 
 #include <stdint.h>
+#include <sched.h>
+#include <sys/types.h>
 #include "lib/utility/ob_macro_utils.h"
 #include "lib/utility/utility.h"
 
@@ -22,6 +24,19 @@ namespace oceanbase
 namespace common
 {
 int64_t get_cpu_count();
+// number of online numa nodes, 0 if the topology can not be read
+int64_t get_numa_node_count();
+// id of the idx-th online numa node, ids are not always contiguous
+int get_numa_node_id(const int64_t idx, int64_t &node_id);
+// number of cpus of numa node, 0 if it can not be read
+int64_t get_numa_node_cpu_count(const int64_t node_id);
+// bind current thread to the cpus of numa node, pages it touches
+// first are then allocated from that node by the kernel
+int bind_thread_to_numa_node(const int64_t node_id);
+// cpus the current thread may run on
+int get_thread_affinity(cpu_set_t &cpu_set);
+// set the cpus thread tid may run on, 0 is the current thread
+int set_thread_affinity(const pid_t tid, const cpu_set_t &cpu_set);
 } // namespace common
 } // namespace oceanbase
 
@@ -35,7 +35,9 @@ private:
   int64_t value_;
 };
 
-template <int64_t SLOT_NUM, typename SlotPicker>
+// ITEM_ALIGN of CACHE_ALIGN_SIZE keeps every slot on its own cache line, use it
+// for counters bumped by all workers on hot paths
+template <int64_t SLOT_NUM, typename SlotPicker, int64_t ITEM_ALIGN = 16>
 class ObCounter
 {
 public:
@@ -67,7 +69,7 @@ private:
   struct Item
   {
     int64_t value_;
-  } __attribute__ ((aligned (16)));
+  } __attribute__ ((aligned (ITEM_ALIGN)));
   Item items_[SLOT_NUM];
 };
 
@@ -96,6 +98,7 @@ static const int64_t OB_COUNTER_MAX_CPU_NUM = 128;
 typedef ObCounter<OB_COUNTER_MAX_THREAD_NUM, ObCounterSlotPickerByThread> ObTCCounter;
 typedef ObCounter<OB_COUNTER_MAX_CPU_NUM, ObCounterSlotPickerByCPU> ObPCCounter;
 typedef ObCounter<OB_COUNTER_MAX_CPU_NUM/4, ObCounterSlotPickerByCPUNonAtomic> ObPCNonAtomicCounter;
+typedef ObCounter<OB_COUNTER_MAX_CPU_NUM, ObCounterSlotPickerByCPU, CACHE_ALIGN_SIZE> ObPCAlignedCounter;
 
 } // end namespace common
 } // end namespace oceanbase
@@ -157,6 +157,19 @@ public:
     return do_pop(data, PRIO_CNT, timeout_us);
   }
 
+  // wake up one waiter of pop() without pushing anything, for callers which
+  // keep part of their tasks in another queue served by the same threads
+  void signal_pop_waiter()
+  {
+    if (PRIO_CNT <= HIGH_HIGH_PRIOS) {
+      cond_.signal(1, 0);
+    } else if (PRIO_CNT <= HIGH_PRIOS + HIGH_HIGH_PRIOS) {
+      cond_.signal(1, 1);
+    } else {
+      cond_.signal(1, 2);
+    }
+  }
+
   int pop_high(ObLink*& data, int64_t timeout_us)
   {
     return do_pop(data, HIGH_HIGH_PRIOS + HIGH_PRIOS, timeout_us);
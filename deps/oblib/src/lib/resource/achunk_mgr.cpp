@@ -38,6 +38,8 @@ void ObLargePageHelper::set_param(const char *param)
       large_page_type_ = PREFER_LARGE_PAGE;
     } else if (0 == strcasecmp(param, "only")) {
       large_page_type_ = ONLY_LARGE_PAGE;
+    } else if (0 == strcasecmp(param, "transparent")) {
+      large_page_type_ = TRANSPARENT_LARGE_PAGE;
     }
     LOG_INFO("set large page param", K(large_page_type_));
   }
@@ -60,7 +62,8 @@ AChunkMgr &AChunkMgr::instance()
 
 AChunkMgr::AChunkMgr()
   : free_list_(), chunk_bitmap_(nullptr), limit_(DEFAULT_LIMIT), urgent_(0), hold_(0),
-    total_hold_(0), maps_(0), unmaps_(0), large_maps_(0), large_unmaps_(0), shadow_hold_(0)
+    total_hold_(0), maps_(0), unmaps_(0), large_maps_(0), large_unmaps_(0), shadow_hold_(0),
+    thp_advised_(0)
 {
 }
 
@@ -196,6 +199,59 @@ void AChunkMgr::low_free(const void *ptr, const uint64_t size)
   ::munmap((void*)ptr, size);
 }
 
+void AChunkMgr::advise_thp(AChunk *chunk, const uint64_t size)
+{
+#ifdef MADV_HUGEPAGE
+  if (ObLargePageHelper::TRANSPARENT_LARGE_PAGE == ObLargePageHelper::get_type() &&
+      !chunk->is_hugetlb_) {
+    // chunks are 2M aligned, so the kernel can back each of them with huge
+    // pages at fault time or collapse them later. failure means thp is
+    // disabled in the kernel and the chunk simply stays on small pages.
+    if (0 == ::madvise(chunk, size, MADV_HUGEPAGE)) {
+      chunk->is_thp_ = true;
+      IGNORE_RETURN ATOMIC_FAA(&thp_advised_, size);
+    } else if (REACH_TIME_INTERVAL(60 * 1000 * 1000)) {
+      LOG_WARN("madvise hugepage failed, fall back to normal pages", K(errno), K(size));
+    }
+  }
+#else
+  UNUSED(chunk);
+  UNUSED(size);
+#endif
+}
+
+void AChunkMgr::account_thp_free(AChunk *chunk, const uint64_t size)
+{
+  if (chunk->is_thp_) {
+    chunk->is_thp_ = false;
+    IGNORE_RETURN ATOMIC_FAA(&thp_advised_, -size);
+  }
+}
+
+bool AChunkMgr::demote_thp(AChunk *chunk)
+{
+  bool bret = true;
+#ifdef MADV_NOHUGEPAGE
+  if (chunk->is_thp_) {
+    // MADV_DONTNEED on part of a huge page chunk only splits the huge page,
+    // khugepaged would collapse the range again and refill the washed pages.
+    // the whole chunk falls back to normal pages so washed memory stays returned.
+    const uint64_t all_size = chunk->aligned();
+    if (0 == ::madvise(chunk, all_size, MADV_NOHUGEPAGE)) {
+      account_thp_free(chunk, all_size);
+    } else {
+      bret = false;
+      if (REACH_TIME_INTERVAL(60 * 1000 * 1000)) {
+        LOG_WARN("madvise nohugepage failed", K(errno), K(all_size));
+      }
+    }
+  }
+#else
+  UNUSED(chunk);
+#endif
+  return bret;
+}
+
 AChunk *AChunkMgr::alloc_chunk(const uint64_t size, bool high_prio)
 {
   const int64_t hold_size = hold(size);
@@ -217,6 +273,7 @@ AChunk *AChunkMgr::alloc_chunk(const uint64_t size, bool high_prio)
         if (ptr != nullptr) {
           chunk = new (ptr) AChunk();
           chunk->is_hugetlb_ = hugetlb_used;
+          advise_thp(chunk, all_size);
         } else {
           IGNORE_RETURN update_hold(-hold_size, high_prio);
         }
@@ -228,6 +285,7 @@ AChunk *AChunkMgr::alloc_chunk(const uint64_t size, bool high_prio)
     bool updated = false;
     while (!(updated = update_hold(hold_size, high_prio)) && free_list_.count() > 0) {
       if (OB_NOT_NULL(chunk = free_list_.pop())) {
+        account_thp_free(chunk, achunk_size);
         direct_free(chunk, achunk_size);
         IGNORE_RETURN update_hold(-achunk_size, high_prio);
         IGNORE_RETURN ATOMIC_FAA(&total_hold_, -achunk_size);
@@ -240,6 +298,7 @@ AChunk *AChunkMgr::alloc_chunk(const uint64_t size, bool high_prio)
       if (ptr != nullptr) {
         chunk = new (ptr) AChunk();
         chunk->is_hugetlb_ = hugetlb_used;
+        advise_thp(chunk, all_size);
       } else {
         IGNORE_RETURN update_hold(-hold_size, high_prio);
       }
@@ -272,10 +331,12 @@ void AChunkMgr::free_chunk(AChunk *chunk)
         freed = !free_list_.push(chunk);
       }
       if (freed) {
+        account_thp_free(chunk, all_size);
         direct_free(chunk, all_size);
         IGNORE_RETURN update_hold(-hold_size, false);
       }
     } else {
+      account_thp_free(chunk, all_size);
       direct_free(chunk, all_size);
       IGNORE_RETURN update_hold(-hold_size, false);
     }
@@ -296,6 +357,7 @@ AChunk *AChunkMgr::alloc_co_chunk(const uint64_t size)
   bool updated = false;
   while (!(updated = update_hold(hold_size, true)) && free_list_.count() > 0) {
     if (OB_NOT_NULL(chunk = free_list_.pop())) {
+      account_thp_free(chunk, achunk_size);
       direct_free(chunk, achunk_size);
       IGNORE_RETURN update_hold(-achunk_size, true);
       IGNORE_RETURN ATOMIC_FAA(&total_hold_, -achunk_size);
@@ -146,7 +146,8 @@ const char *const use_large_pages_confs[] =
 {
   "true",
   "false",
-  "only"
+  "only",
+  "transparent"
 };
 
 class ObLargePageHelper
@@ -156,6 +157,8 @@ public:
   static const int NO_LARGE_PAGE = 0;
   static const int PREFER_LARGE_PAGE = 1;
   static const int ONLY_LARGE_PAGE = 2;
+  // regular mappings advised with MADV_HUGEPAGE, no hugetlbfs reservation needed
+  static const int TRANSPARENT_LARGE_PAGE = 3;
 public:
   static void set_param(const char *param);
   static int get_type();
@@ -205,6 +208,9 @@ public:
   inline int64_t get_large_maps()  { return large_maps_; }
   inline int64_t get_large_unmaps()  { return large_unmaps_; }
   inline int64_t get_shadow_hold() const { return ATOMIC_LOAD(&shadow_hold_); }
+  inline int64_t get_thp_advised() const { return ATOMIC_LOAD(&thp_advised_); }
+  // take a chunk out of transparent huge page before its pages are washed
+  bool demote_thp(AChunk *chunk);
 
 private:
   typedef ABitSet ChunkBitMap;
@@ -215,6 +221,8 @@ private:
   // wrap for mmap
   void *low_alloc(const uint64_t size, const bool can_use_huge_page, bool &huge_page_used, const bool alloc_shadow);
   void low_free(const void *ptr, const uint64_t size);
+  void advise_thp(AChunk *chunk, const uint64_t size);
+  void account_thp_free(AChunk *chunk, const uint64_t size);
 
 protected:
   AChunkList free_list_;
@@ -230,6 +238,7 @@ protected:
   int64_t large_maps_;
   int64_t large_unmaps_;
   int64_t shadow_hold_;
+  int64_t thp_advised_; // bytes advised as transparent huge page, not the real huge page coverage
 }; // end of class AChunkMgr
 
 OB_INLINE AChunk *AChunkMgr::ptr2chunk(const void *ptr)
@@ -34,6 +34,37 @@ int safe_backtrace(char *buf, int64_t len, int64_t *pos)
   return ret;
 }
 
+int64_t safe_backtrace_from_signal(uintptr_t *addrs, int64_t max_cnt)
+{
+  int64_t cnt = 0;
+  int in_handler = 1;
+  unw_context_t context;
+  unw_cursor_t cursor;
+  unw_word_t uip;
+  if (max_cnt <= 0) {
+    // do nothing
+  } else if (unw_getcontext(&context) < 0 || unw_init_local(&cursor, &context) < 0) {
+    cnt = -1;
+  } else {
+    // skip the frames of the handler itself, the interrupted one is right
+    // above the signal frame
+    while (cnt >= 0 && cnt < max_cnt) {
+      int r = unw_step(&cursor);
+      if (r <= 0) {
+        cnt = (r < 0 ? -1 : cnt);
+        break;
+      } else if (unw_get_reg(&cursor, UNW_REG_IP, &uip) < 0) {
+        cnt = -1;
+      } else if (in_handler) {
+        in_handler = (unw_is_signal_frame(&cursor) > 0) ? 0 : 1;
+      } else {
+        addrs[cnt++] = uip;
+      }
+    }
+  }
+  return cnt;
+}
+
 static int safe_backtrace_(unw_context_t *context, char *buf, int64_t len,
                    int64_t *pos)
 {
@@ -18,6 +18,9 @@
 
 EXTERN_C_BEGIN
 extern int safe_backtrace(char *buf, int64_t len, int64_t *pos);
+// return the count of frames above the innermost signal frame written to addrs,
+// -1 if the stack can not be walked. only used from inside a signal handler.
+extern int64_t safe_backtrace_from_signal(uintptr_t *addrs, int64_t max_cnt);
 EXTERN_C_END
 
 #endif
@@ -190,7 +190,18 @@ int ObRpcProcessorBase::deserialize()
 
     if (OB_SUCC(ret)) {
       char* new_buf = nullptr;
-      if (preserve_recv_data_) {
+      if (preserve_recv_data_ && nullptr != uncompressed_buf_ && ez_buf == uncompressed_buf_) {
+        // the decompressed payload is owned by the processor already, take it
+        // over as the preserved buffer instead of copying it once more
+        new_buf = uncompressed_buf_;
+        uncompressed_buf_ = nullptr;
+        if (OB_FAIL(decode_base(new_buf, len, pos))) {
+          int pcode = m_get_pcode();
+          RPC_OBRPC_LOG(WARN, "decode argument fail", K(pcode), K(ret));
+          common::ob_free(new_buf);
+          new_buf = nullptr;
+        }
+      } else if (preserve_recv_data_) {
         new_buf = static_cast<char*>(
             common::ob_malloc(len, common::ObModIds::OB_RPC_PROCESSOR));
         if (OB_ISNULL(new_buf)) {
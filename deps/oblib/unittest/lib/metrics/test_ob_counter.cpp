@@ -0,0 +1,91 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include "lib/utility/utility.h"
+#include "lib/ob_define.h"
+#include "lib/time/ob_time_utility.h"
+#include "lib/metrics/ob_counter.h"
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+using namespace oceanbase::common;
+
+static const int64_t INC_PER_THREAD = 100000;
+
+template <typename Counter>
+int64_t run_inc(Counter &counter, const int64_t thread_cnt)
+{
+  std::vector<std::thread> threads;
+  const int64_t start_ts = ObTimeUtility::current_time();
+  for (int64_t i = 0; i < thread_cnt; i++) {
+    threads.emplace_back([&counter]() {
+      for (int64_t j = 0; j < INC_PER_THREAD; j++) {
+        counter.inc();
+      }
+    });
+  }
+  for (auto &th : threads) {
+    th.join();
+  }
+  return ObTimeUtility::current_time() - start_ts;
+}
+
+TEST(ObCounter, aligned_slot)
+{
+  ASSERT_EQ(0, sizeof(ObPCAlignedCounter) % CACHE_ALIGN_SIZE);
+  ASSERT_EQ(OB_COUNTER_MAX_CPU_NUM * CACHE_ALIGN_SIZE, sizeof(ObPCAlignedCounter));
+  ObPCAlignedCounter counter;
+  ASSERT_EQ(0, counter.value());
+  counter.inc();
+  counter.inc(10);
+  counter.dec(3);
+  ASSERT_EQ(8, counter.value());
+  counter.reset();
+  ASSERT_EQ(0, counter.value());
+}
+
+TEST(ObCounter, concurrent_inc)
+{
+  const int64_t max_thread_cnt = std::min(get_max_icpu_id(), 128L);
+  for (int64_t thread_cnt = 1; thread_cnt <= max_thread_cnt; thread_cnt *= 2) {
+    ObPCAlignedCounter aligned;
+    ObPCCounter packed;
+    run_inc(aligned, thread_cnt);
+    run_inc(packed, thread_cnt);
+    ASSERT_EQ(thread_cnt * INC_PER_THREAD, aligned.value());
+    ASSERT_EQ(thread_cnt * INC_PER_THREAD, packed.value());
+  }
+}
+
+// perf test, run with --gtest_also_run_disabled_tests on a host with many cpus
+TEST(ObCounter, DISABLED_inc_scaling)
+{
+  for (int64_t thread_cnt = 1; thread_cnt <= 128; thread_cnt *= 2) {
+    ObPCAlignedCounter aligned;
+    ObPCCounter packed;
+    ObSimpleCounter shared;
+    const int64_t aligned_us = run_inc(aligned, thread_cnt);
+    const int64_t packed_us = run_inc(packed, thread_cnt);
+    const int64_t shared_us = run_inc(shared, thread_cnt);
+    ASSERT_EQ(thread_cnt * INC_PER_THREAD, aligned.value());
+    ASSERT_EQ(thread_cnt * INC_PER_THREAD, packed.value());
+    ASSERT_EQ(thread_cnt * INC_PER_THREAD, shared.value());
+    fprintf(stdout, "threads=%ld aligned_us=%ld packed_us=%ld shared_us=%ld\n",
+            thread_cnt, aligned_us, packed_us, shared_us);
+  }
+}
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc,argv);
+  return RUN_ALL_TESTS();
+}
@@ -15,6 +15,7 @@
 #include "lib/queue/ob_priority_queue.h"
 #include "lib/thread/thread_pool.h"
 #include <iostream>
+#include <thread>
 
 using namespace oceanbase::lib;
 using namespace oceanbase::common;
@@ -126,6 +127,29 @@ TEST(TestPriorityQueue, WithCoro)
   tq.do_stress();
 }
 
+TEST(TestPriorityQueue, SignalPopWaiter)
+{
+  ObPriorityQueue2<0, 1> queue;
+  bool done = false;
+  int64_t elapsed = 0;
+  int pop_ret = OB_SUCCESS;
+  std::thread waiter([&]() {
+    ObLink *data = NULL;
+    const int64_t start = ObTimeUtility::current_time();
+    pop_ret = queue.pop(data, 5 * 1000 * 1000L);
+    elapsed = ObTimeUtility::current_time() - start;
+    ATOMIC_STORE(&done, true);
+  });
+  // a signal sent before the waiter is prepared is lost, keep sending
+  while (!ATOMIC_LOAD(&done)) {
+    ::usleep(50 * 1000);
+    queue.signal_pop_waiter();
+  }
+  waiter.join();
+  ASSERT_EQ(OB_ENTRY_NOT_EXIST, pop_ret);
+  ASSERT_LT(elapsed, 1000 * 1000L);
+}
+
 int main(int argc, char *argv[])
 {
   oceanbase::common::ObLogger::get_logger().set_log_level("debug");
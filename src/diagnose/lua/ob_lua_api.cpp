@@ -1348,11 +1348,11 @@ int select_dump_tenant_info(lua_State *L)
       // recv_hp_rpc_cnt
       gen.next_column(t.recv_hp_rpc_cnt_);
       // recv_np_rpc_cnt
-      gen.next_column(t.recv_np_rpc_cnt_);
+      gen.next_column(t.recv_np_rpc_cnt_.value());
       // recv_lp_rpc_cnt
       gen.next_column(t.recv_lp_rpc_cnt_);
       // recv_mysql_cnt
-      gen.next_column(t.recv_mysql_cnt_);
+      gen.next_column(t.recv_mysql_cnt_.value());
       // recv_task_cnt
       gen.next_column(t.recv_task_cnt_);
       // recv_large_req_cnt
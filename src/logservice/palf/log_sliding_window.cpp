@@ -177,6 +177,7 @@ int LogSlidingWindow::init(const int64_t palf_id,
     committed_end_lsn_ = palf_base_info.curr_lsn_;
 
     MEMSET(append_cnt_array_, 0, APPEND_CNT_ARRAY_SIZE * sizeof(int64_t));
+    MEMSET(append_size_array_, 0, APPEND_CNT_ARRAY_SIZE * sizeof(int64_t));
 
     is_inited_ = true;
     LogGroupEntryHeader group_header;
@@ -393,6 +394,7 @@ int LogSlidingWindow::submit_log(const char *buf,
       const int64_t array_idx = get_itid() & APPEND_CNT_ARRAY_MASK;
       OB_ASSERT(0 <= array_idx && array_idx < APPEND_CNT_ARRAY_SIZE);
       ATOMIC_INC(&append_cnt_array_[array_idx]);
+      ATOMIC_AAF(&append_size_array_[array_idx], valid_log_size);
 
       LSN last_submit_end_lsn, max_flushed_end_lsn;
       get_last_submit_end_lsn_(last_submit_end_lsn);
@@ -1062,23 +1064,31 @@ int LogSlidingWindow::check_and_switch_freeze_mode()
 {
   int ret = OB_SUCCESS;
   int64_t total_append_cnt = 0;
+  int64_t total_append_size = 0;
   for (int i = 0; i < APPEND_CNT_ARRAY_SIZE; ++i) {
     total_append_cnt += ATOMIC_LOAD(&append_cnt_array_[i]);
     ATOMIC_STORE(&append_cnt_array_[i], 0);
+    total_append_size += ATOMIC_LOAD(&append_size_array_[i]);
+    ATOMIC_STORE(&append_size_array_[i], 0);
   }
+  const int64_t avg_append_size = (0 == total_append_cnt) ? 0 : total_append_size / total_append_cnt;
+  const bool need_period_freeze = (total_append_cnt >= APPEND_CNT_LB_FOR_PERIOD_FREEZE)
+      || (total_append_cnt >= SMALL_LOG_APPEND_CNT_LB_FOR_PERIOD_FREEZE
+          && avg_append_size <= SMALL_LOG_AVG_SIZE_UB_FOR_PERIOD_FREEZE);
   if (FEEDBACK_FREEZE_MODE == freeze_mode_) {
-    if (total_append_cnt >= APPEND_CNT_LB_FOR_PERIOD_FREEZE) {
+    if (need_period_freeze) {
       freeze_mode_ = PERIOD_FREEZE_MODE;
-      PALF_LOG(INFO, "switch freeze_mode to period", K_(palf_id), K_(self), K(total_append_cnt));
+      PALF_LOG(INFO, "switch freeze_mode to period", K_(palf_id), K_(self), K(total_append_cnt), K(avg_append_size));
     }
   } else if (PERIOD_FREEZE_MODE == freeze_mode_) {
-    if (total_append_cnt < APPEND_CNT_LB_FOR_PERIOD_FREEZE) {
+    if (!need_period_freeze) {
       freeze_mode_ = FEEDBACK_FREEZE_MODE;
-      PALF_LOG(INFO, "switch freeze_mode to feedback", K_(palf_id), K_(self), K(total_append_cnt));
+      PALF_LOG(INFO, "switch freeze_mode to feedback", K_(palf_id), K_(self), K(total_append_cnt), K(avg_append_size));
       (void) feedback_freeze_last_log_();
     }
   } else {}
-  PALF_LOG(TRACE, "finish check_and_switch_freeze_mode", K_(palf_id), K_(self), K(total_append_cnt), K_(freeze_mode));
+  PALF_LOG(TRACE, "finish check_and_switch_freeze_mode", K_(palf_id), K_(self), K(total_append_cnt),
+      K(avg_append_size), K_(freeze_mode));
   return ret;
 }
 
@@ -341,6 +341,11 @@ public:
   static const int64_t APPEND_CNT_ARRAY_SIZE = 32;   // append次数统计数组的size
   static const uint64_t APPEND_CNT_ARRAY_MASK = APPEND_CNT_ARRAY_SIZE - 1;
   static const int64_t APPEND_CNT_LB_FOR_PERIOD_FREEZE = 130000;   // 切为PERIOD_FREEZE_MODE的append count下界
+  // For tiny logs (e.g. commit logs of small single-LS transactions), the per group entry overhead
+  // dominates, so switch to PERIOD_FREEZE_MODE at a lower append count to aggregate more of them
+  // into one group entry.
+  static const int64_t SMALL_LOG_APPEND_CNT_LB_FOR_PERIOD_FREEZE = 30000;
+  static const int64_t SMALL_LOG_AVG_SIZE_UB_FOR_PERIOD_FREEZE = 512;
 private:
   struct LogTaskGuard
   {
@@ -462,6 +467,7 @@ private:
   int64_t accum_group_log_size_;
   int64_t last_record_group_log_id_;
   int64_t append_cnt_array_[APPEND_CNT_ARRAY_SIZE];
+  int64_t append_size_array_[APPEND_CNT_ARRAY_SIZE];
   FreezeMode freeze_mode_;
   bool is_inited_;
 private:
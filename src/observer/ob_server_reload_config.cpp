@@ -30,6 +30,7 @@
 #include "storage/tx_storage/ob_tenant_freezer.h"
 #include "storage/compaction/ob_tenant_tablet_scheduler.h"
 #include "storage/slog/ob_storage_logger_manager.h"
+#include "sql/optimizer/ob_opt_est_cost.h"
 
 using namespace oceanbase::lib;
 using namespace oceanbase::common;
@@ -242,6 +243,10 @@ int ObServerReloadConfig::operator()()
     (void)GCTX.set_upgrade_stage(new_upgrade_stage);
   }
 
+  sql::ObOptEstCost::set_cost_scale(GCONF._optimizer_cpu_cost_scale,
+                                    GCONF._optimizer_seq_io_cost_scale,
+                                    GCONF._optimizer_rnd_io_cost_scale);
+
   // syslog bandwidth limitation
   share::ObTaskController::get().set_log_rate_limit(
       GCONF.syslog_io_bandwidth_limit.get_value());
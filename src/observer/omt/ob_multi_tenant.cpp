@@ -1941,6 +1941,7 @@ void ObMultiTenant::run1()
         if (!OB_ISNULL(*it)) {
           ObTaskController::get().allow_next_syslog();
           LOG_INFO("dump tenant info", "tenant", **it);
+          (*it)->dump_queue_delay_stat();
         }
       }
     }
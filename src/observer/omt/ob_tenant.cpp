@@ -225,6 +225,66 @@ void ObPxPool::run1()
   }
 }
 
+void ReqQueueDelayStat::reset()
+{
+  for (int64_t i = 0; i < SHARD_CNT; i++) {
+    for (int64_t j = 0; j < BUCKET_CNT; j++) {
+      ATOMIC_STORE(&shards_[i].cnt_[j], 0);
+    }
+  }
+}
+
+void ReqQueueDelayStat::add(const int64_t delay_us)
+{
+  // bucket i holds delays in [2^(i-1), 2^i)
+  int64_t idx = delay_us > 0 ? 64 - __builtin_clzll(delay_us) : 0;
+  idx = min(idx, BUCKET_CNT - 1);
+  ATOMIC_INC(&shards_[ObCounterSlotPickerByCPU::get_my_id() % SHARD_CNT].cnt_[idx]);
+}
+
+int64_t ReqQueueDelayStat::get_shard_cnt_() const
+{
+  const int64_t max_id = ObCounterSlotPickerByCPU::get_max_id();
+  return max_id < SHARD_CNT ? max_id : SHARD_CNT;
+}
+
+int64_t ReqQueueDelayStat::get_bucket_cnt_(const int64_t idx) const
+{
+  int64_t cnt = 0;
+  const int64_t shard_cnt = get_shard_cnt_();
+  for (int64_t i = 0; i < shard_cnt; i++) {
+    cnt += ATOMIC_LOAD(&shards_[i].cnt_[idx]);
+  }
+  return cnt;
+}
+
+int64_t ReqQueueDelayStat::get_cnt() const
+{
+  int64_t cnt = 0;
+  for (int64_t i = 0; i < BUCKET_CNT; i++) {
+    cnt += get_bucket_cnt_(i);
+  }
+  return cnt;
+}
+
+int64_t ReqQueueDelayStat::get_percentile(const int64_t pct) const
+{
+  int64_t delay_us = 0;
+  const int64_t total = get_cnt();
+  if (total > 0) {
+    const int64_t target = (total * pct + 99) / 100;
+    int64_t cnt = 0;
+    for (int64_t i = 0; i < BUCKET_CNT; i++) {
+      cnt += get_bucket_cnt_(i);
+      if (cnt >= target) {
+        delay_us = 1L << i;
+        break;
+      }
+    }
+  }
+  return delay_us;
+}
+
 int ObResourceGroup::init()
 {
   int ret = OB_SUCCESS;
@@ -544,9 +604,7 @@ ObTenant::ObTenant(const int64_t id,
       req_queue_(),
       large_req_queue_(),
       recv_hp_rpc_cnt_(0),
-      recv_np_rpc_cnt_(0),
       recv_lp_rpc_cnt_(0),
-      recv_mysql_cnt_(0),
       recv_task_cnt_(0),
       recv_sql_task_cnt_(0),
       recv_large_req_cnt_(0),
@@ -556,7 +614,6 @@ ObTenant::ObTenant(const int64_t id,
       recv_retry_on_lock_mysql_cnt_(0),
       actives_(0),
       tt_large_quries_(0),
-      pop_normal_cnt_(0),
       worker_pool_(),
       group_map_(group_map_buf_, sizeof(group_map_buf_)),
       lock_(),
@@ -990,13 +1047,27 @@ int ObTenant::get_new_request(
     w.set_large_query(false);
     w.set_curr_request_level(0);
     wk_level = w.get_worker_level();
-    if (OB_SUCC(w.get_group()->req_queue_.pop(task, timeout))) {
-      w.get_group()->atomic_inc_pop_cnt();
+    ObResourceGroup *group = w.get_group();
+    // Short requests go first, the large lane is served when there is no
+    // short one or once every LARGE_LANE_POP_INTERVAL pops.
+    if (group->large_req_queue_.size() > 0 &&
+        (group->req_queue_.size() == 0 ||
+         0 == group->get_pop_req_cnt() % ObResourceGroup::LARGE_LANE_POP_INTERVAL) &&
+        OB_SUCCESS == group->large_req_queue_.pop(task)) {
+      w.set_large_query();
+    } else {
+      ret = group->req_queue_.pop(task, timeout);
+    }
+    if (OB_SUCC(ret)) {
+      group->atomic_inc_pop_cnt();
       EVENT_INC(REQUEST_DEQUEUE_COUNT);
       if (nullptr == req && nullptr != task) {
         req = static_cast<rpc::ObRequest*>(task);
-        if (req->large_retry_flag()) {
-          w.set_large_query();
+        const int64_t delay = ObTimeUtility::current_time() - req->get_enqueue_timestamp();
+        if (w.large_query()) {
+          group->large_queue_delay_.add(delay);
+        } else {
+          group->short_queue_delay_.add(delay);
         }
       }
     }
@@ -1052,7 +1123,7 @@ int ObTenant::get_new_request(
       } else {
         // If large requests exist and this worker doesn't have LQT but
         // can acquire, do it.
-        ATOMIC_INC(&pop_normal_cnt_);
+        pop_normal_cnt_.inc();
         if (large_req_queue_.size() > 0 &&
             !w.has_lq_token() &&
             acquire_lq_token()) {
@@ -1079,6 +1150,12 @@ int ObTenant::get_new_request(
     EVENT_INC(REQUEST_DEQUEUE_COUNT);
     if (nullptr == req && nullptr != task) {
       req = static_cast<rpc::ObRequest*>(task);
+      const int64_t delay = ObTimeUtility::current_time() - req->get_enqueue_timestamp();
+      if (w.large_query()) {
+        large_queue_delay_.add(delay);
+      } else {
+        short_queue_delay_.add(delay);
+      }
     }
     if (nullptr != req && req->get_type() == ObRequest::OB_RPC) {
         using obrpc::ObRpcPacket;
@@ -1146,7 +1223,14 @@ int ObTenant::recv_request(ObRequest &req)
     }
     if (OB_SUCC(ret)) {
       group->atomic_inc_recv_cnt();
-      if (OB_FAIL(group->req_queue_.push(&req, 0))) {
+      if (req.large_retry_flag()) {
+        if (OB_FAIL(group->large_req_queue_.push(&req))) {
+          LOG_ERROR("push request to large queue fail", K(ret), K(this));
+        } else {
+          // idle group workers block in req_queue_.pop, wake one of them up
+          group->req_queue_.signal_pop_waiter();
+        }
+      } else if (OB_FAIL(group->req_queue_.push(&req, 0))) {
         LOG_ERROR("push request to queue fail", K(ret), K(this));
       }
     }
@@ -1191,7 +1275,7 @@ int ObTenant::recv_request(ObRequest &req)
             LOG_WARN("push request to QQ_PRIOR_TO_NORMAL queue fail", K(ret), K(this));
           }
         } else if (is_normal_prio(pkt) || is_low_prio(pkt)) {
-          ATOMIC_INC(&recv_np_rpc_cnt_);
+          recv_np_rpc_cnt_.inc();
           if (OB_FAIL(req_queue_.push(&req, QQ_NORMAL))) {
             LOG_WARN("push request to queue fail", K(ret), K(this));
           }
@@ -1216,7 +1300,7 @@ int ObTenant::recv_request(ObRequest &req)
           LOG_WARN("push request to RQ_HIGH queue fail", K(ret), K(this));
         }
       } else {
-        ATOMIC_INC(&recv_mysql_cnt_);
+        recv_mysql_cnt_.inc();
         if (OB_FAIL(req_queue_.push(&req, RQ_NORMAL))) {
           LOG_WARN("push request to queue fail", K(ret), K(this));
         }
@@ -1299,6 +1383,26 @@ void ObTenant::handle_retry_req()
   }
 }
 
+void ObTenant::dump_queue_delay_stat()
+{
+  LOG_INFO("dump tenant queue delay", K_(id),
+           "short_lane", short_queue_delay_, "large_lane", large_queue_delay_);
+  short_queue_delay_.reset();
+  large_queue_delay_.reset();
+  ObResourceGroupNode* iter = NULL;
+  ObResourceGroup* group = nullptr;
+  while (NULL != (iter = group_map_.quick_next(iter))) {
+    group = static_cast<ObResourceGroup*>(iter);
+    if (group->short_queue_delay_.get_cnt() > 0 || group->large_queue_delay_.get_cnt() > 0) {
+      LOG_INFO("dump group queue delay", K_(id), "group_id", group->get_group_id(),
+               "short_lane", group->short_queue_delay_,
+               "large_lane", group->large_queue_delay_);
+    }
+    group->short_queue_delay_.reset();
+    group->large_queue_delay_.reset();
+  }
+}
+
 void ObTenant::calibrate_token_count()
 {
   if (dynamic_modify_token_ || OB_DATA_TENANT_ID == id_) {
@@ -1317,14 +1421,15 @@ void ObTenant::calibrate_token_count()
           }
         }
       }
-      if (last_pop_normal_cnt_ != 0 && pop_normal_cnt_ == last_pop_normal_cnt_) {
+      const int64_t pop_normal_cnt = pop_normal_cnt_.value();
+      if (last_pop_normal_cnt_ != 0 && pop_normal_cnt == last_pop_normal_cnt_) {
         set_token(min(token_cnt_ + 1, worker_count_bound()));
       }
       if (wait_worker > active_workers / 2) {
         set_token(max(token_cnt_ - 1, sug_token_cnt_));
       }
       last_calibrate_token_ts_ = current_time;
-      last_pop_normal_cnt_ = pop_normal_cnt_;
+      last_pop_normal_cnt_ = pop_normal_cnt;
       IGNORE_RETURN workers_lock_.unlock();
     }
   }
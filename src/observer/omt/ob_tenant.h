@@ -22,6 +22,7 @@
 #include "lib/lock/ob_spin_lock.h"
 #include "lib/lock/ob_mutex.h"
 #include "lib/atomic/ob_atomic.h"
+#include "lib/metrics/ob_counter.h"
 #include "lib/thread/ob_thread_name.h"
 #include "lib/rc/ob_rc.h"
 #include "rpc/ob_request.h"
@@ -204,6 +205,36 @@ private:
   volatile uint64_t cnt_[MAX_REQUEST_LEVEL];
 };
 
+// Queueing delay of the requests popped from one lane, in log2 buckets of us.
+// Every dequeue adds to it, so the buckets are kept per cpu.
+class ReqQueueDelayStat {
+public:
+  static const int64_t BUCKET_CNT = 24; // the last bucket holds delays >= 2^22us
+  static const int64_t SHARD_CNT = common::OB_COUNTER_MAX_CPU_NUM;
+  ReqQueueDelayStat() { reset(); }
+  ~ReqQueueDelayStat() {}
+  void reset();
+  void add(const int64_t delay_us);
+  int64_t get_cnt() const;
+  // upper bound of the bucket which holds the pct-th percentile, 0 if empty
+  int64_t get_percentile(const int64_t pct) const;
+  int64_t to_string(char *buf, const int64_t buf_len) const
+  {
+    int64_t pos = 0;
+    common::databuff_printf(buf, buf_len, pos, "cnt=%ld p50=%ldus p99=%ldus",
+                            get_cnt(), get_percentile(50), get_percentile(99));
+    return pos;
+  }
+private:
+  int64_t get_bucket_cnt_(const int64_t idx) const;
+  int64_t get_shard_cnt_() const;
+private:
+  struct Shard {
+    volatile uint64_t cnt_[BUCKET_CNT];
+  } CACHE_ALIGNED;
+  Shard shards_[SHARD_CNT];
+};
+
 class ObResourceGroupNode : public common::SpHashNode
 {
 public:
@@ -248,6 +279,9 @@ public:
   using WList = common::ObDList<WListNode>;
   enum { CALIBRATE_TOKEN_INTERVAL = 100 * 1000 };
   static constexpr int64_t PRESERVE_INACTIVE_WORKER_TIME = 10 * 1000L * 1000L;
+  // while short requests are waiting, only one of this many pops serves the
+  // large lane, so long running requests can not take all workers
+  static constexpr uint64_t LARGE_LANE_POP_INTERVAL = 8;
 
   ObResourceGroup(int32_t group_id, ObTenant *tenant, ObWorkerPool *worker_pool, share::ObCgroupCtrl *cgroup_ctrl):
     ObResourceGroupNode(group_id),
@@ -297,6 +331,10 @@ public:
 protected:
   WList workers_;
   common::ObPriorityQueue2<0, 1> req_queue_;
+  // requests retried as large queries, kept apart from the short ones
+  common::ObLinkQueue large_req_queue_;
+  ReqQueueDelayStat short_queue_delay_;
+  ReqQueueDelayStat large_queue_delay_;
 
 private:
   bool inited_;                              // Mark whether the container has threads and queues allocated
@@ -339,6 +377,7 @@ public:
       common::databuff_printf(buf, buf_len, pos,
        "group_id = %d,"
        "queue_size = %ld,"
+       "large_queue_size = %ld,"
        "recv_req_cnt = %lu,"
        "pop_req_cnt = %lu,"
        "token_cnt = %ld,"
@@ -347,6 +386,7 @@ public:
        "ass_token_cnt = %ld ",
        group->group_id_,
        group->req_queue_.size(),
+       group->large_req_queue_.size(),
        group->recv_req_cnt_,
        group->pop_req_cnt_,
        group->token_cnt_,
@@ -470,6 +510,8 @@ public:
   void calibrate_group_token_count();
   void calibrate_worker_count();
   int timeup();
+  // log queueing delay of each lane since the last call and start over
+  void dump_queue_delay_stat();
 
   TO_STRING_KV(K_(id),
                K_(tenant_meta),
@@ -479,12 +521,12 @@ public:
                K_(lq_tokens),
                K_(used_lq_tokens),
                K_(stopped), K_(idle_us),
-               K_(recv_hp_rpc_cnt), K_(recv_np_rpc_cnt),
-               K_(recv_lp_rpc_cnt), K_(recv_mysql_cnt),
+               K_(recv_hp_rpc_cnt), "recv_np_rpc_cnt", recv_np_rpc_cnt_.value(),
+               K_(recv_lp_rpc_cnt), "recv_mysql_cnt", recv_mysql_cnt_.value(),
                K_(recv_task_cnt),
                K_(recv_large_req_cnt),
                K_(tt_large_quries),
-               K_(pop_normal_cnt),
+               "pop_normal_cnt", pop_normal_cnt_.value(),
                K_(actives),
                "workers", workers_.get_size(),
                "nesting workers", nesting_workers_.get_size(),
@@ -614,6 +656,8 @@ protected:
   // 'hp' for high priority and 'np' for normal priority
   common::ObPriorityQueue2<1, QQ_MAX_PRIO - 1, RQ_MAX_PRIO - QQ_MAX_PRIO> req_queue_;
   common::ObLinkQueue large_req_queue_;
+  ReqQueueDelayStat short_queue_delay_;
+  ReqQueueDelayStat large_queue_delay_;
 
   //Create a request queue for each level of nested requests
   ObMultiLevelQueue *multi_level_queue_;
@@ -623,9 +667,11 @@ protected:
   ObRetryQueue retry_queue_;
 
   volatile uint64_t recv_hp_rpc_cnt_;
-  volatile uint64_t recv_np_rpc_cnt_;
+  // bumped for every request, sharded by cpu so io threads and workers do not
+  // bounce one cache line
+  common::ObPCAlignedCounter recv_np_rpc_cnt_;
   volatile uint64_t recv_lp_rpc_cnt_;
-  volatile uint64_t recv_mysql_cnt_;
+  common::ObPCAlignedCounter recv_mysql_cnt_;
   volatile uint64_t recv_task_cnt_;
   volatile uint64_t recv_sql_task_cnt_;
   volatile uint64_t recv_large_req_cnt_;
@@ -635,7 +681,7 @@ protected:
   volatile uint64_t recv_retry_on_lock_mysql_cnt_;
   volatile uint64_t actives_;
   volatile uint64_t tt_large_quries_;
-  volatile uint64_t pop_normal_cnt_;
+  common::ObPCAlignedCounter pop_normal_cnt_;
 
   // free worker pool
   ObWorkerPool worker_pool_;
@@ -21,6 +21,7 @@
 #include "lib/allocator/ob_page_manager.h"
 #include "lib/rc/context.h"
 #include "lib/thread/ob_thread_name.h"
+#include "lib/cpu/ob_cpu_topology.h"
 #include "ob_tenant.h"
 #include "ob_worker_processor.h"
 #include "share/config/ob_server_config.h"
@@ -52,8 +53,11 @@ ObThWorker::ObThWorker()
       query_start_time_(0), last_check_time_(0),
       can_retry_(true), need_retry_(false),
       active_(false), waiting_active_(false),
-      active_inactive_ts_(0L), lq_token_(false), has_add_to_cgroup_(false)
+      active_inactive_ts_(0L), lq_token_(false), has_add_to_cgroup_(false),
+      has_bind_numa_node_(false), is_numa_bound_(false),
+      has_origin_cpu_set_(false)
 {
+  CPU_ZERO(&origin_cpu_set_);
 }
 
 ObThWorker::~ObThWorker()
@@ -71,12 +75,26 @@ int ObThWorker::init()
   } else if (OB_FAIL(run_cond_.init(ObWaitEventIds::TH_WORKER_COND_WAIT))) {
     LOG_ERROR("init run cond fail, ", K(ret));
   } else {
+    // the worker thread inherits the cpus of the thread creating it
+    has_origin_cpu_set_ = (OB_SUCCESS == get_thread_affinity(origin_cpu_set_));
     is_inited_ = true;
   }
 
   return ret;
 }
 
+void ObThWorker::restore_cpu_affinity_(const pid_t tid)
+{
+  int tmp_ret = OB_SUCCESS;
+  if (!is_numa_bound_ || !has_origin_cpu_set_) {
+    // the worker runs on its origin cpus
+  } else if (OB_SUCCESS != (tmp_ret = set_thread_affinity(tid, origin_cpu_set_))) {
+    LOG_WARN("fail to restore worker cpu affinity", K(tmp_ret), K(tid));
+  } else {
+    is_numa_bound_ = false;
+  }
+}
+
 void ObThWorker::destroy()
 {
   if (is_inited_) {
@@ -380,6 +398,31 @@ void ObThWorker::worker(int64_t &tenant_id, int64_t &req_recv_timestamp, int32_t
           GCTX.cgroup_ctrl_->add_thread_to_cgroup(get_tid(), tenant_->id(), get_group_id());
           has_add_to_cgroup_ = true;
         }
+        if (!has_bind_numa_node_) {
+          // meta tenant follows its user tenant, user tenants are spread over nodes
+          const int64_t numa_node_cnt = GCONF._enable_numa_aware_placement ? get_numa_node_count() : 0;
+          bool is_bound = false;
+          if (numa_node_cnt > 1) {
+            const int64_t node_idx = (gen_user_tenant_id(tenant_->id()) / 2) % numa_node_cnt;
+            int64_t node_id = -1;
+            int tmp_ret = OB_SUCCESS;
+            if (OB_SUCCESS != (tmp_ret = get_numa_node_id(node_idx, node_id))) {
+              LOG_WARN("fail to get numa node", K(tmp_ret), K(tenant_->id()), K(node_idx));
+            } else if (tenant_->unit_max_cpu() > get_numa_node_cpu_count(node_id)) {
+              // a tenant larger than one node keeps all cpus instead of being squeezed into it
+            } else if (OB_SUCCESS != (tmp_ret = bind_thread_to_numa_node(node_id))) {
+              LOG_WARN("fail to bind worker to numa node", K(tmp_ret), K(tenant_->id()), K(node_id));
+            } else {
+              is_bound = true;
+              is_numa_bound_ = true;
+            }
+          }
+          if (!is_bound) {
+            // may still be bound by the previous tenant if reset failed to restore
+            restore_cpu_affinity_(0);
+          }
+          has_bind_numa_node_ = true;
+        }
         if (OB_LIKELY(pm != nullptr)) {
           if (pm->get_used() != 0) {
             LOG_ERROR("page manager's used should be 0, unexpected!!!", KP(pm));
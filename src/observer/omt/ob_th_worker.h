@@ -14,6 +14,7 @@
 #define _OCEABASE_OBSERVER_OMT_OB_TH_WORKER_H_
 
 #include <pthread.h>
+#include <sched.h>
 #include "lib/worker.h"
 #include "lib/lock/ob_thread_cond.h"
 #include "rpc/ob_request.h"
@@ -142,6 +143,15 @@ private:
   int64_t active_inactive_ts_;
   bool lq_token_;
   bool has_add_to_cgroup_;
+  bool has_bind_numa_node_;
+  // bound to the numa node of the tenant, restored to origin_cpu_set_ once
+  // the worker serves another tenant
+  bool is_numa_bound_;
+  bool has_origin_cpu_set_;
+  cpu_set_t origin_cpu_set_;
+
+private:
+  void restore_cpu_affinity_(const pid_t tid);
 
 private:
   DISALLOW_COPY_AND_ASSIGN(ObThWorker);
@@ -161,6 +171,9 @@ inline void ObThWorker::reset()
   need_retry_ = false;
   active_ = false;
   has_add_to_cgroup_ = false;
+  // the pool hands the worker to other tenants, do not keep it on this node
+  restore_cpu_affinity_(get_tid());
+  has_bind_numa_node_ = false;
   unset_tidx();
 }
 
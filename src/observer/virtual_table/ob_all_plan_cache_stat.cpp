@@ -118,18 +118,20 @@ int ObAllPlanCacheStat::fill_cells(ObPlanCache &plan_cache)
       break;
     }
     case ACCESS_COUNT: {
-      cells[i].set_int(pc_stat.access_count_);
+      cells[i].set_int(pc_stat.access_count_.value());
       break;
     }
     case HIT_COUNT: {
-      cells[i].set_int(pc_stat.hit_count_);
+      cells[i].set_int(pc_stat.hit_count_.value());
       break;
     }
     //hit_rate
     case HIT_RATE: {
-      if (pc_stat.access_count_ !=0) {
-        cells[i].set_int(pc_stat.hit_count_*100/pc_stat.access_count_);
-        SERVER_LOG(DEBUG, "rate:", "hit_count", pc_stat.hit_count_, "access_count", pc_stat.access_count_);
+      const int64_t access_count = pc_stat.access_count_.value();
+      const int64_t hit_count = pc_stat.hit_count_.value();
+      if (access_count != 0) {
+        cells[i].set_int(hit_count * 100 / access_count);
+        SERVER_LOG(DEBUG, "rate:", K(hit_count), K(access_count));
       } else {
         cells[i].set_int(0);
       }
@@ -106,7 +106,7 @@ int ObAllVirtualDumpTenantInfo::inner_get_next_row(common::ObNewRow *&row)
           break;
         case OB_APP_MIN_COLUMN_ID + 15:
           //recv_np_rpc_cnt
-          cells[i].set_int(t.recv_np_rpc_cnt_);
+          cells[i].set_int(t.recv_np_rpc_cnt_.value());
           break;
         case OB_APP_MIN_COLUMN_ID + 16:
           //recv_lp_rpc_cnt
@@ -114,7 +114,7 @@ int ObAllVirtualDumpTenantInfo::inner_get_next_row(common::ObNewRow *&row)
           break;
         case OB_APP_MIN_COLUMN_ID + 17:
           //recv_mysql_cnt
-          cells[i].set_int(t.recv_mysql_cnt_);
+          cells[i].set_int(t.recv_mysql_cnt_.value());
           break;
         case OB_APP_MIN_COLUMN_ID + 18:
           //recv_task_cnt
@@ -17,6 +17,8 @@
 #include "share/ob_thread_mgr.h"
 #include "share/ash/ob_active_sess_hist_task.h"
 #include "share/ash/ob_active_sess_hist_list.h"
+#include "share/ash/ob_cpu_profiler.h"
+#include "share/config/ob_server_config.h"
 #include "sql/session/ob_sql_session_mgr.h"
 
 using namespace oceanbase::common;
@@ -65,6 +67,7 @@ void ObActiveSessHistTask::wait()
 
 void ObActiveSessHistTask::stop()
 {
+  ObCpuProfiler::get_instance().refresh(false);
   TG_STOP(lib::TGDefIDs::ActiveSessHist);
 }
 
@@ -79,6 +82,7 @@ void ObActiveSessHistTask::runTimerTask()
     sample_time_ = ObTimeUtility::current_time();
     GCTX.session_mgr_->for_each_session(*this);
   }
+  ObCpuProfiler::get_instance().refresh(GCONF._enable_cpu_profiler);
 }
 
 bool ObActiveSessHistTask::operator()(sql::ObSQLSessionMgr::Key key, ObSQLSessionInfo *sess_info)
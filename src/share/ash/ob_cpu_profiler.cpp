@@ -0,0 +1,212 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SHARE
+
+#include "share/ash/ob_cpu_profiler.h"
+#include <sys/time.h>
+#include <algorithm>
+#include "lib/oblog/ob_log.h"
+#include "lib/ash/ob_active_session_guard.h"
+#include "lib/hash_func/murmur_hash.h"
+#include "lib/signal/ob_libunwind.h"
+#include "lib/container/ob_se_array.h"
+#include "lib/container/ob_se_array_iterator.h"
+
+using namespace oceanbase::common;
+using namespace oceanbase::share;
+
+ObCpuProfiler &ObCpuProfiler::get_instance()
+{
+  static ObCpuProfiler the_one;
+  return the_one;
+}
+
+ObCpuProfiler::ObCpuProfiler()
+  : handler_installed_(false),
+    running_(false),
+    active_handler_cnt_(0),
+    sample_cnt_(0),
+    drop_cnt_(0),
+    start_ts_(0)
+{
+  MEMSET(entries_, 0, sizeof(entries_));
+}
+
+void ObCpuProfiler::refresh(const bool enable)
+{
+  int ret = OB_SUCCESS;
+  if (enable && !is_running()) {
+    if (OB_FAIL(start())) {
+      LOG_WARN("fail to start cpu profiler", K(ret));
+    }
+  } else if (!enable && is_running()) {
+    stop();
+    report();
+  } else if (enable && ObTimeUtility::current_time() - start_ts_ >= REPORT_INTERVAL_US) {
+    stop();
+    report();
+    if (OB_FAIL(start())) {
+      LOG_WARN("fail to restart cpu profiler", K(ret));
+    }
+  }
+}
+
+int ObCpuProfiler::start()
+{
+  int ret = OB_SUCCESS;
+  if (!handler_installed_) {
+    struct sigaction sa;
+    sa.sa_flags = SA_SIGINFO | SA_RESTART;
+    sa.sa_sigaction = sigprof_handler;
+    sigemptyset(&sa.sa_mask);
+    if (-1 == sigaction(SIGPROF, &sa, nullptr)) {
+      ret = OB_ERR_SYS;
+      LOG_WARN("fail to install sigprof handler", K(ret), K(errno));
+    } else {
+      handler_installed_ = true;
+    }
+  }
+  if (OB_SUCC(ret)) {
+    struct itimerval timer;
+    timer.it_interval.tv_sec = 0;
+    timer.it_interval.tv_usec = SAMPLE_INTERVAL_US;
+    timer.it_value = timer.it_interval;
+    clear();
+    start_ts_ = ObTimeUtility::current_time();
+    ATOMIC_STORE(&running_, true);
+    if (-1 == setitimer(ITIMER_PROF, &timer, nullptr)) {
+      ret = OB_ERR_SYS;
+      ATOMIC_STORE(&running_, false);
+      LOG_WARN("fail to arm profiling timer", K(ret), K(errno));
+    } else {
+      LOG_INFO("cpu profiler started", "interval_us", SAMPLE_INTERVAL_US);
+    }
+  }
+  return ret;
+}
+
+void ObCpuProfiler::stop()
+{
+  int ret = OB_SUCCESS;
+  struct itimerval timer;
+  MEMSET(&timer, 0, sizeof(timer));
+  ATOMIC_STORE(&running_, false);
+  if (-1 == setitimer(ITIMER_PROF, &timer, nullptr)) {
+    ret = OB_ERR_SYS;
+    LOG_WARN("fail to disarm profiling timer", K(ret), K(errno));
+  }
+  // a signal may still be in delivery on another thread
+  while (ATOMIC_LOAD(&active_handler_cnt_) > 0) {
+    PAUSE();
+  }
+}
+
+void ObCpuProfiler::clear()
+{
+  MEMSET(entries_, 0, sizeof(entries_));
+  sample_cnt_ = 0;
+  drop_cnt_ = 0;
+}
+
+void ObCpuProfiler::sigprof_handler(int sig, siginfo_t *si, void *context)
+{
+  UNUSED(sig);
+  UNUSED(si);
+  UNUSED(context);
+  const int saved_errno = errno;
+  ObCpuProfiler &profiler = get_instance();
+  ATOMIC_INC(&profiler.active_handler_cnt_);
+  if (profiler.is_running()) {
+    profiler.record_sample();
+  }
+  ATOMIC_DEC(&profiler.active_handler_cnt_);
+  errno = saved_errno;
+}
+
+void ObCpuProfiler::record_sample()
+{
+  uintptr_t frames[MAX_STACK_DEPTH];
+  const int64_t depth = safe_backtrace_from_signal(frames, MAX_STACK_DEPTH);
+  ATOMIC_INC(&sample_cnt_);
+  if (depth <= 0) {
+    ATOMIC_INC(&drop_cnt_);
+  } else {
+    const ActiveSessionStat &stat = ObActiveSessionGuard::get_stat();
+    uint64_t hash = murmurhash64A(frames, static_cast<int32_t>(depth * sizeof(frames[0])), 0);
+    hash = murmurhash64A(&stat.tenant_id_, sizeof(stat.tenant_id_), hash);
+    hash = murmurhash64A(&stat.plan_line_id_, sizeof(stat.plan_line_id_), hash);
+    hash = murmurhash64A(stat.sql_id_, static_cast<int32_t>(STRLEN(stat.sql_id_)), hash);
+    hash = (0 == hash ? 1 : hash);
+    bool done = false;
+    for (int64_t i = 0; !done && i < MAX_PROBE_CNT; i++) {
+      Entry &entry = entries_[(hash + i) & (ENTRY_CNT - 1)];
+      uint64_t cur = ATOMIC_LOAD(&entry.hash_);
+      if (0 == cur && ATOMIC_BCAS(&entry.hash_, 0, hash)) {
+        entry.tenant_id_ = stat.tenant_id_;
+        entry.plan_line_id_ = stat.plan_line_id_;
+        entry.depth_ = static_cast<int32_t>(depth);
+        MEMCPY(entry.sql_id_, stat.sql_id_, sizeof(entry.sql_id_));
+        entry.sql_id_[sizeof(entry.sql_id_) - 1] = '\0';
+        MEMCPY(entry.frames_, frames, depth * sizeof(frames[0]));
+        ATOMIC_INC(&entry.sample_cnt_);
+        ATOMIC_STORE(&entry.ready_, true);
+        done = true;
+      } else if (hash == ATOMIC_LOAD(&entry.hash_)) {
+        // the owner may still be filling it, the sample is lost in that case
+        if (ATOMIC_LOAD(&entry.ready_)) {
+          ATOMIC_INC(&entry.sample_cnt_);
+        } else {
+          ATOMIC_INC(&drop_cnt_);
+        }
+        done = true;
+      }
+    }
+    if (!done) {
+      ATOMIC_INC(&drop_cnt_);
+    }
+  }
+}
+
+void ObCpuProfiler::report()
+{
+  int ret = OB_SUCCESS;
+  ObSEArray<const Entry *, REPORT_TOP_N> top;
+  for (int64_t i = 0; OB_SUCC(ret) && i < ENTRY_CNT; i++) {
+    const Entry &entry = entries_[i];
+    if (!ATOMIC_LOAD(&entry.ready_)) {
+      // skip
+    } else if (OB_FAIL(top.push_back(&entry))) {
+      LOG_WARN("fail to push back", K(ret));
+    }
+  }
+  if (OB_SUCC(ret)) {
+    std::sort(top.begin(), top.end(), [](const Entry *l, const Entry *r) {
+      return l->sample_cnt_ > r->sample_cnt_;
+    });
+    LOG_INFO("[CPU_PROFILE] summary", "duration_us", ObTimeUtility::current_time() - start_ts_,
+             K_(sample_cnt), K_(drop_cnt), "stack_cnt", top.count());
+    char stack[MAX_STACK_DEPTH * 20];
+    for (int64_t i = 0; i < top.count() && i < REPORT_TOP_N; i++) {
+      const Entry &entry = *top.at(i);
+      int64_t pos = 0;
+      // folded stack, outermost frame first
+      for (int64_t j = entry.depth_ - 1; j >= 0; j--) {
+        (void)databuff_printf(stack, sizeof(stack), pos, j > 0 ? "0x%lx;" : "0x%lx",
+                              entry.frames_[j]);
+      }
+      LOG_INFO("[CPU_PROFILE]", "tenant_id", entry.tenant_id_, "sql_id", entry.sql_id_,
+               "plan_line_id", entry.plan_line_id_, "samples", entry.sample_cnt_,
+               "stack", stack);
+    }
+  }
+}
@@ -0,0 +1,85 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef _OB_SHARE_ASH_CPU_PROFILER_H_
+#define _OB_SHARE_ASH_CPU_PROFILER_H_
+
+#include <signal.h>
+#include "lib/ob_define.h"
+#include "lib/atomic/ob_atomic.h"
+
+namespace oceanbase
+{
+namespace share
+{
+
+/*
+ * In-process on-cpu sampler.
+ *
+ * ITIMER_PROF delivers SIGPROF to the thread that is burning cpu, the handler
+ * walks the interrupted stack and accumulates it into a bounded table keyed by
+ * (tenant, sql_id, plan line, stack), which are taken from the ASH stat of the
+ * sampled thread. No memory is allocated in the handler, a sample which does
+ * not find a slot is only counted as dropped.
+ *
+ * The table is reported to the log as folded stacks periodically and cleared
+ * afterwards. Addresses can be symbolized offline with addr2line.
+ */
+class ObCpuProfiler
+{
+public:
+  static const int64_t SAMPLE_INTERVAL_US = 10 * 1000L; // 100Hz of cpu time
+  static const int64_t REPORT_INTERVAL_US = 60 * 1000L * 1000L;
+  static const int64_t REPORT_TOP_N = 32;
+  static const int64_t MAX_STACK_DEPTH = 32;
+  static const int64_t ENTRY_CNT = 4096; // power of 2
+  static const int64_t MAX_PROBE_CNT = 16;
+  struct Entry
+  {
+    uint64_t hash_; // 0 means the slot is free
+    bool ready_;
+    uint64_t tenant_id_;
+    int32_t plan_line_id_;
+    int32_t depth_;
+    int64_t sample_cnt_;
+    char sql_id_[common::OB_MAX_SQL_ID_LENGTH + 1];
+    uintptr_t frames_[MAX_STACK_DEPTH];
+  };
+public:
+  static ObCpuProfiler &get_instance();
+  // start or stop sampling according to enable and report if it is time to
+  void refresh(const bool enable);
+  bool is_running() const { return ATOMIC_LOAD(&running_); }
+  int start();
+  void stop();
+  void report();
+private:
+  ObCpuProfiler();
+  ~ObCpuProfiler() = default;
+  static void sigprof_handler(int sig, siginfo_t *si, void *context);
+  void record_sample();
+  void clear();
+private:
+  bool handler_installed_;
+  bool running_;
+  int64_t active_handler_cnt_;
+  int64_t sample_cnt_;
+  int64_t drop_cnt_;
+  int64_t start_ts_;
+  Entry entries_[ENTRY_CNT];
+  DISALLOW_COPY_AND_ASSIGN(ObCpuProfiler);
+};
+
+}
+}
+#endif /* _OB_SHARE_ASH_CPU_PROFILER_H_ */
+//// end of header file
@@ -328,6 +328,7 @@ int ObKVGlobalCache::put(
   pvalue = NULL;
   mb_handle = NULL;
   MBWrapper *mb_wrapper = NULL;
+  enum ObKVCachePolicy policy = LRU;
   if (OB_UNLIKELY(!inited_)) {
     ret = OB_NOT_INIT;
     COMMON_LOG(WARN, "The ObKVGlobalCache has not been inited, ", K(ret));
@@ -339,9 +340,11 @@ int ObKVGlobalCache::put(
   } else if (NULL == inst_handle.get_inst()) {
     ret = OB_ERR_UNEXPECTED;
     COMMON_LOG(WARN, "The inst is NULL, ", K(ret));
-  } else if (!overwrite && (OB_SUCC(map_.get(cache_id, key, pvalue, mb_handle)))) {
+  } else if (!overwrite && (OB_SUCC(map_.get(cache_id, key, pvalue, mb_handle, false /*record_access*/)))) {
     ret = OB_ENTRY_EXIST;
-  } else if (OB_FAIL(store.store(*inst_handle.get_inst(), key, value, kvpair, mb_wrapper))) {
+  } else if (OB_FAIL(map_.get_put_policy(cache_id, key, policy))) {
+    COMMON_LOG(WARN, "Fail to get put policy, ", K(ret));
+  } else if (OB_FAIL(store.store(*inst_handle.get_inst(), key, value, kvpair, mb_wrapper, policy))) {
     COMMON_LOG(WARN, "Fail to store kvpair to store, ", K(ret));
   } else {
     mb_handle = mb_wrapper->get_mb_handle();
@@ -0,0 +1,146 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include "share/cache/ob_kvcache_frequency_sketch.h"
+#include "lib/allocator/ob_malloc.h"
+#include "lib/coro/co_var.h"
+
+namespace oceanbase
+{
+namespace common
+{
+
+ObKVCacheFrequencySketch::ObKVCacheFrequencySketch()
+  : is_inited_(false),
+    table_(NULL),
+    word_num_(0),
+    counter_mask_(0),
+    sample_size_(0),
+    add_cnt_(0)
+{
+}
+
+ObKVCacheFrequencySketch::~ObKVCacheFrequencySketch()
+{
+  destroy();
+}
+
+int ObKVCacheFrequencySketch::init(const int64_t counter_num)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(is_inited_)) {
+    ret = OB_INIT_TWICE;
+    COMMON_LOG(WARN, "The ObKVCacheFrequencySketch has been inited, ", K(ret));
+  } else if (OB_UNLIKELY(counter_num <= 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    COMMON_LOG(WARN, "Invalid argument, ", K(counter_num), K(ret));
+  } else {
+    int64_t real_counter_num = MIN_COUNTER_NUM;
+    while (real_counter_num < counter_num && real_counter_num < MAX_COUNTER_NUM) {
+      real_counter_num <<= 1;
+    }
+    const int64_t word_num = real_counter_num / COUNTERS_PER_WORD;
+    if (OB_ISNULL(table_ = static_cast<uint64_t *>(ob_malloc(sizeof(uint64_t) * word_num,
+                                                             "CACHE_SKETCH")))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      COMMON_LOG(WARN, "Fail to allocate memory for sketch, ", K(ret), K(word_num));
+    } else {
+      MEMSET(table_, 0, sizeof(uint64_t) * word_num);
+      word_num_ = word_num;
+      counter_mask_ = real_counter_num - 1;
+      sample_size_ = SAMPLE_FACTOR * real_counter_num;
+      add_cnt_ = 0;
+      is_inited_ = true;
+    }
+  }
+  return ret;
+}
+
+void ObKVCacheFrequencySketch::destroy()
+{
+  if (NULL != table_) {
+    ob_free(table_);
+    table_ = NULL;
+  }
+  word_num_ = 0;
+  counter_mask_ = 0;
+  sample_size_ = 0;
+  add_cnt_ = 0;
+  is_inited_ = false;
+}
+
+void ObKVCacheFrequencySketch::increment(const uint64_t hash_code)
+{
+  if (OB_LIKELY(is_inited_)) {
+    bool added = false;
+    for (int64_t i = 0; i < DEPTH; ++i) {
+      const uint64_t idx = get_index(hash_code, i);
+      uint64_t *word = &table_[idx / COUNTERS_PER_WORD];
+      const int64_t shift = (idx % COUNTERS_PER_WORD) * COUNTER_BITS;
+      bool done = false;
+      while (!done) {
+        const uint64_t old_val = ATOMIC_LOAD(word);
+        if (((old_val >> shift) & MAX_COUNTER_VALUE) == MAX_COUNTER_VALUE) {
+          done = true;
+        } else if (ATOMIC_BCAS(word, old_val, old_val + (1ULL << shift))) {
+          done = true;
+          added = true;
+        }
+      }
+    }
+    if (added) {
+      // increments are counted per thread and published in batches, so the
+      // workers do not all bump one shared cache line on every cache get
+      RLOCAL(const ObKVCacheFrequencySketch *, batch_owner);
+      RLOCAL(int64_t, batch_cnt);
+      if (batch_owner != this) {
+        batch_owner = this;
+        batch_cnt = 0;
+      }
+      if (++batch_cnt >= ADD_CNT_BATCH) {
+        const int64_t new_cnt = ATOMIC_AAF(&add_cnt_, batch_cnt);
+        // exactly one thread crosses the sample size and ages the sketch
+        if (new_cnt >= sample_size_ && new_cnt - batch_cnt < sample_size_) {
+          halve();
+          (void) ATOMIC_SAF(&add_cnt_, sample_size_ / 2);
+        }
+        batch_cnt = 0;
+      }
+    }
+  }
+}
+
+int64_t ObKVCacheFrequencySketch::estimate(const uint64_t hash_code) const
+{
+  int64_t freq = 0;
+  if (OB_LIKELY(is_inited_)) {
+    freq = MAX_COUNTER_VALUE;
+    for (int64_t i = 0; i < DEPTH; ++i) {
+      const uint64_t idx = get_index(hash_code, i);
+      const int64_t shift = (idx % COUNTERS_PER_WORD) * COUNTER_BITS;
+      const int64_t cnt = (ATOMIC_LOAD(&table_[idx / COUNTERS_PER_WORD]) >> shift) & MAX_COUNTER_VALUE;
+      freq = cnt < freq ? cnt : freq;
+    }
+  }
+  return freq;
+}
+
+void ObKVCacheFrequencySketch::halve()
+{
+  for (int64_t i = 0; i < word_num_; ++i) {
+    // shift every 4-bit counter right by one and drop the bit borrowed from its neighbour
+    ATOMIC_STORE(&table_[i], (ATOMIC_LOAD(&table_[i]) >> 1) & 0x7777777777777777ULL);
+  }
+}
+
+}//end namespace common
+}//end namespace oceanbase
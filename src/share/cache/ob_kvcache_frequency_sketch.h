@@ -0,0 +1,73 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_CACHE_OB_KVCACHE_FREQUENCY_SKETCH_H_
+#define OCEANBASE_CACHE_OB_KVCACHE_FREQUENCY_SKETCH_H_
+
+#include "share/ob_define.h"
+
+namespace oceanbase
+{
+namespace common
+{
+
+// Count-min sketch of 4-bit counters used as the admission filter of kvcache.
+// It remembers how often a key has been referenced recently, including keys
+// that are not (or no longer) in cache, so that one-shot accesses such as a
+// large range scan can be told apart from re-referenced hot keys.
+// All counters are halved once the number of increments reaches the sample
+// size, which lets the frequency of keys that went cold decay. Each thread
+// reports its increments in batches of ADD_CNT_BATCH, so halving may happen
+// a little late.
+// Updates are lock free and may be lost under races, which is acceptable for
+// an estimation.
+class ObKVCacheFrequencySketch
+{
+public:
+  ObKVCacheFrequencySketch();
+  virtual ~ObKVCacheFrequencySketch();
+  int init(const int64_t counter_num);
+  void destroy();
+  void increment(const uint64_t hash_code);
+  int64_t estimate(const uint64_t hash_code) const;
+  OB_INLINE bool is_inited() const { return is_inited_; }
+  TO_STRING_KV(K_(is_inited), K_(word_num), K_(sample_size), K_(add_cnt));
+private:
+  OB_INLINE uint64_t get_index(const uint64_t hash_code, const int64_t depth) const
+  {
+    // double hashing, the second hash must be odd to walk all counters
+    const uint64_t h2 = ((hash_code >> 32) | (hash_code << 32)) * 0x9E3779B97F4A7C15ULL | 1;
+    return (hash_code + depth * h2) & counter_mask_;
+  }
+  void halve();
+private:
+  static const int64_t DEPTH = 4;
+  static const int64_t COUNTER_BITS = 4;
+  static const int64_t COUNTERS_PER_WORD = 64 / COUNTER_BITS;
+  static const uint64_t MAX_COUNTER_VALUE = (1ULL << COUNTER_BITS) - 1;
+  static const int64_t SAMPLE_FACTOR = 10;
+  static const int64_t ADD_CNT_BATCH = 64;
+  static const int64_t MIN_COUNTER_NUM = 1L << 12;
+  static const int64_t MAX_COUNTER_NUM = 1L << 23;
+  bool is_inited_;
+  uint64_t *table_;
+  int64_t word_num_;
+  uint64_t counter_mask_;
+  int64_t sample_size_;
+  int64_t add_cnt_;
+  DISALLOW_COPY_AND_ASSIGN(ObKVCacheFrequencySketch);
+};
+
+}//end namespace common
+}//end namespace oceanbase
+
+#endif //OCEANBASE_CACHE_OB_KVCACHE_FREQUENCY_SKETCH_H_
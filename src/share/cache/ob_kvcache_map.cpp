@@ -53,6 +53,8 @@ int ObKVCacheMap::init(const int64_t bucket_num, ObKVCacheStore *store)
     COMMON_LOG(WARN, "Fail to init bucket lock, ", K(bucket_num), K(ret));
   } else if (OB_FAIL(global_hazard_version_.init(HAZARD_VERSION_THREAD_WAITING_THRESHOLD))) {
     COMMON_LOG(WARN, "Fail to init hazard version, ", K(ret));
+  } else if (OB_FAIL(sketch_.init(bucket_num))) {
+    COMMON_LOG(WARN, "Fail to init frequency sketch, ", K(ret), K(bucket_num));
   } else {
     bucket_size_ = DEFAULT_BUCKET_SIZE;
     if (is_mini_mode()) {
@@ -122,6 +124,7 @@ void ObKVCacheMap::destroy()
     buckets_ = NULL;
   }
   global_hazard_version_.destroy();
+  sketch_.destroy();
   bucket_lock_.destroy();
   bucket_num_ = 0;
   bucket_size_ = 0;
@@ -218,7 +221,11 @@ int ObKVCacheMap::put(
           }
           (void) ATOMIC_AAF(&mb_handle->kv_cnt_, 1);
           (void) ATOMIC_AAF(&mb_handle->get_cnt_, 1);
-          ++mb_handle->recent_get_cnt_;
+          if (sketch_.estimate(hash_code) >= ADMIT_FREQ_THRESHOLD) {
+            ++mb_handle->recent_get_cnt_;
+          } else {
+            inst.status_.total_admit_reject_cnt_.inc();
+          }
           inst.status_.total_put_cnt_.inc();
 
           // add new node to list
@@ -242,7 +249,8 @@ int ObKVCacheMap::get(
     const int64_t cache_id,
     const ObIKVCacheKey &key,
     const ObIKVCacheValue *&pvalue,
-    ObKVMemBlockHandle *&out_handle)
+    ObKVMemBlockHandle *&out_handle,
+    const bool record_access)
 {
   int ret = OB_SUCCESS;
   uint64_t hash_code = 0;
@@ -263,6 +271,7 @@ int ObKVCacheMap::get(
     int64_t mb_get_cnt = 0;
     int64_t mb_handle_kv_cnt = 0;
     ObKVCachePolicy mb_policy = LFU;
+    bool hit_sampled = false;
 
     GlobalHazardVersionGuard hazard_guard(global_hazard_version_);
     if (OB_FAIL(hazard_guard.get_ret())) {
@@ -280,10 +289,13 @@ int ObKVCacheMap::get(
               pvalue = iter->value_;
               out_handle = iter->mb_handle_;
 
-              mb_get_cnt = ATOMIC_AAF(&out_handle->get_cnt_, 1);
-              mb_handle_kv_cnt = out_handle->kv_cnt_;
-              ++out_handle->recent_get_cnt_;
-              iter_get_cnt = ++ iter->get_cnt_;
+              if (is_hit_stat_sampled()) {
+                hit_sampled = true;
+                mb_get_cnt = ATOMIC_AAF(&out_handle->get_cnt_, HIT_STAT_SAMPLE_RATE);
+                mb_handle_kv_cnt = out_handle->kv_cnt_;
+                out_handle->recent_get_cnt_ += HIT_STAT_SAMPLE_RATE;
+                iter_get_cnt = (iter->get_cnt_ += HIT_STAT_SAMPLE_RATE);
+              }
               iter->inst_->status_.total_hit_cnt_.inc();
               mb_policy = out_handle->policy_;
 
@@ -298,8 +310,16 @@ int ObKVCacheMap::get(
       if (OB_FAIL(ret)) {
       } else if (NULL == iter) {
         ret = OB_ENTRY_NOT_EXIST;
+        if (record_access) {
+          sketch_.increment(hash_code);
+        }
       } else {
-        if (LRU == mb_policy && need_modify_cache(iter_get_cnt, mb_get_cnt, mb_handle_kv_cnt)) {
+        if (record_access && LRU == mb_policy) {
+          // hits on LFU blocks are already protected, only count probationary ones
+          sketch_.increment(hash_code);
+        }
+        if (hit_sampled && LRU == mb_policy
+            && need_modify_cache(iter_get_cnt, mb_get_cnt, mb_handle_kv_cnt)) {
           int tmp_ret = OB_SUCCESS;
           ObBucketWLockGuard guard(bucket_lock_, bucket_pos);
           if (OB_TMP_FAIL(guard.get_ret())) {
@@ -336,6 +356,26 @@ int ObKVCacheMap::get(
   return ret;
 }
 
+int ObKVCacheMap::get_put_policy(
+    const int64_t cache_id,
+    const ObIKVCacheKey &key,
+    enum ObKVCachePolicy &policy)
+{
+  int ret = OB_SUCCESS;
+  uint64_t hash_code = 0;
+  policy = LRU;
+
+  if (OB_UNLIKELY(!is_inited_)) {
+    ret = OB_NOT_INIT;
+    COMMON_LOG(WARN, "The ObKVCacheMap has not been inited, ", K(ret));
+  } else if (OB_FAIL(key.hash(hash_code))) {
+    COMMON_LOG(WARN, "Failed to get kvcache key hash", K(ret));
+  } else if (sketch_.estimate(hash_code + cache_id) >= LFU_PUT_FREQ_THRESHOLD) {
+    policy = LFU;
+  }
+  return ret;
+}
+
 int ObKVCacheMap::erase(const int64_t cache_id, const ObIKVCacheKey &key)
 {
   int ret = OB_SUCCESS;
@@ -18,6 +18,7 @@
 #include "share/cache/ob_kvcache_struct.h"
 #include "share/cache/ob_kvcache_store.h"
 #include "share/cache/ob_kvcache_hazard_version.h"
+#include "share/cache/ob_kvcache_frequency_sketch.h"
 
 namespace oceanbase
 {
@@ -29,6 +30,14 @@ class ObKVCacheMap
   static constexpr int64_t DEFAULT_BUCKET_SIZE = (16L << 20); // 16M
   static constexpr int64_t MIN_BUCKET_SIZE     = ( 4L << 10); //  4K
   static const int64_t HAZARD_VERSION_THREAD_WAITING_THRESHOLD = 512;
+  // a put only adds to the score of its block when the key has been referenced
+  // before, so blocks filled by one-shot scans are washed first
+  static const int64_t ADMIT_FREQ_THRESHOLD = 2;
+  static const int64_t LFU_PUT_FREQ_THRESHOLD = 4;
+  // a hit only writes the get counters of its node and block once out of
+  // this many hits of the thread, with the counters weighted accordingly,
+  // so hot keys read by many threads do not keep bouncing those lines
+  static const int64_t HIT_STAT_SAMPLE_RATE = 8;
   
 public:
   ObKVCacheMap();
@@ -51,8 +60,11 @@ public:
     const int64_t cache_id,
     const ObIKVCacheKey &key,
     const ObIKVCacheValue *&pvalue,
-    ObKVMemBlockHandle *&out_handle);
+    ObKVMemBlockHandle *&out_handle,
+    const bool record_access = true);
   int erase(const int64_t cache_id, const ObIKVCacheKey &key);
+  // keys referenced often enough recently are put into LFU blocks directly
+  int get_put_policy(const int64_t cache_id, const ObIKVCacheKey &key, enum ObKVCachePolicy &policy);
   void print_hazard_version_info();
 private:
   friend class ObKVCacheIterator;
@@ -88,6 +100,11 @@ private:
   void internal_map_erase(Node *&prev, Node *&iter, Node *&bucket_ptr);
   void internal_map_replace(Node *&prev, Node *&iter, Node *&bucket_ptr);
   int internal_data_move(Node *&prev, Node *&iter, Node *&bucket_ptr, const enum ObKVCachePolicy policy);
+  OB_INLINE bool is_hit_stat_sampled() const
+  {
+    RLOCAL_INLINE(uint64_t, hit_seq);
+    return 0 == (++hit_seq % HIT_STAT_SAMPLE_RATE);
+  }
   OB_INLINE bool need_modify_cache(const int64_t iter_get_cnt, const int64_t total_get_cnt, const int64_t kv_cnt) const
   {
     bool ret = false;
@@ -112,6 +129,7 @@ private:
   ObBucketLock bucket_lock_;
   ObKVCacheStore *store_;
   GlobalHazardVersion global_hazard_version_;
+  ObKVCacheFrequencySketch sketch_;
 };
 
 }//end namespace common
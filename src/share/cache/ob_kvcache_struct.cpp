@@ -62,6 +62,7 @@ void ObKVCacheStatus::reset()
   lfu_mb_cnt_ = 0;
   total_put_cnt_.reset();
   total_hit_cnt_.reset();
+  total_admit_reject_cnt_.reset();
   total_miss_cnt_ = 0;
   last_hit_cnt_ = 0;
   base_mb_score_ = 0;
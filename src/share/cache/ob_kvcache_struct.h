@@ -188,11 +188,14 @@ public:
   inline int64_t get_hold_size() const { return ATOMIC_LOAD(&hold_size_); }
   void reset();
   TO_STRING_KV(KP_(config), K_(kv_cnt), K_(store_size), K_(map_size), K_(lru_mb_cnt),
-      K_(lfu_mb_cnt), K_(base_mb_score), K_(hold_size));
+      K_(lfu_mb_cnt), K_(base_mb_score), K_(hold_size), "hit_ratio", get_hit_ratio(),
+      "put_cnt", total_put_cnt_.value(), "admit_reject_cnt", total_admit_reject_cnt_.value());
 
   const ObKVCacheConfig *config_;
   ObPCNonAtomicCounter total_put_cnt_;
   ObPCNonAtomicCounter total_hit_cnt_;
+  // puts of keys not referenced before, they do not raise the score of their block
+  ObPCNonAtomicCounter total_admit_reject_cnt_;
   int64_t kv_cnt_;
   int64_t store_size_;
   int64_t lru_mb_cnt_;
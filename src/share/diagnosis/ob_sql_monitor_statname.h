@@ -44,6 +44,8 @@ SQL_MONITOR_STATNAME_DEF(MEMORY_DUMP, sql_monitor_statname::CAPACITY, "memory du
 // GI
 SQL_MONITOR_STATNAME_DEF(FILTERED_GRANULE_COUNT, sql_monitor_statname::INT, "filtered granule count", "filtered granule count in GI op")
 SQL_MONITOR_STATNAME_DEF(TOTAL_GRANULE_COUNT, sql_monitor_statname::INT, "total granule count", "total granule count in GI op")
+SQL_MONITOR_STATNAME_DEF(GRANULE_BUSY_TIME, sql_monitor_statname::INT, "granule busy time", "time in us the worker spent from fetching its first granule to running out of granules")
+SQL_MONITOR_STATNAME_DEF(GRANULE_END_TIMESTAMP, sql_monitor_statname::TIMESTAMP, "granule end time", "the timestamp the worker ran out of granules, its idle time is the gap to the last worker of the dfo")
 //end
 SQL_MONITOR_STATNAME_DEF(MONITOR_STATNAME_END, sql_monitor_statname::INVALID, "monitor end", "monitor stat name end")
 #endif
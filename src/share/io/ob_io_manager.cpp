@@ -811,23 +811,26 @@ int ObTenantIOManager::trace_request_if_need(const ObIORequest *req, const char*
 void ObTenantIOManager::print_io_status()
 {
   if (is_working()) {
-    ObIOUsage::AvgItems avg_iops, avg_size, avg_rt;
+    ObIOUsage::AvgItems avg_iops, avg_size, avg_rt, p99_rt;
     io_usage_.calculate_io_usage();
     io_usage_.get_io_usage(avg_iops, avg_size, avg_rt);
+    io_usage_.get_io_rt_p99(p99_rt);
     char io_status[1024] = { 0 };
     bool need_print_io_config = false;
     for (int64_t i = 0; i < static_cast<int>(ObIOCategory::MAX_CATEGORY); ++i) {
       if (avg_size[i][static_cast<int>(ObIOMode::READ)] > std::numeric_limits<double>::epsilon()) {
-        snprintf(io_status, sizeof(io_status), "category: %8s, mode:  read, size: %10.2f, iops: %8.2f, rt: %8.2f",
+        snprintf(io_status, sizeof(io_status), "category: %8s, mode:  read, size: %10.2f, iops: %8.2f, rt: %8.2f, p99_rt: %8.0f",
             get_io_category_name((ObIOCategory)i),
-            avg_size[i][static_cast<int>(ObIOMode::READ)], avg_iops[i][static_cast<int>(ObIOMode::READ)], avg_rt[i][static_cast<int>(ObIOMode::READ)]);
+            avg_size[i][static_cast<int>(ObIOMode::READ)], avg_iops[i][static_cast<int>(ObIOMode::READ)], avg_rt[i][static_cast<int>(ObIOMode::READ)],
+            p99_rt[i][static_cast<int>(ObIOMode::READ)]);
         LOG_INFO("[IO STATUS]", K_(tenant_id), KCSTRING(io_status));
         need_print_io_config = true;
       }
       if (avg_size[i][static_cast<int>(ObIOMode::WRITE)] > std::numeric_limits<double>::epsilon()) {
-        snprintf(io_status, sizeof(io_status), "category: %8s, mode: write, size: %10.2f, iops: %8.2f, rt: %8.2f",
+        snprintf(io_status, sizeof(io_status), "category: %8s, mode: write, size: %10.2f, iops: %8.2f, rt: %8.2f, p99_rt: %8.0f",
             get_io_category_name((ObIOCategory)i),
-            avg_size[i][static_cast<int>(ObIOMode::WRITE)], avg_iops[i][static_cast<int>(ObIOMode::WRITE)], avg_rt[i][static_cast<int>(ObIOMode::WRITE)]);
+            avg_size[i][static_cast<int>(ObIOMode::WRITE)], avg_iops[i][static_cast<int>(ObIOMode::WRITE)], avg_rt[i][static_cast<int>(ObIOMode::WRITE)],
+            p99_rt[i][static_cast<int>(ObIOMode::WRITE)]);
         LOG_INFO("[IO STATUS]", K_(tenant_id), KCSTRING(io_status));
         need_print_io_config = true;
       }
@@ -358,7 +358,7 @@ ObIOStat::ObIOStat()
     io_bytes_(0),
     io_rt_us_(0)
 {
-
+  MEMSET(rt_hist_, 0, sizeof(rt_hist_));
 }
 
 ObIOStat::~ObIOStat()
@@ -371,6 +371,9 @@ void ObIOStat::accumulate(const uint64_t io_count, const uint64_t io_bytes, cons
   ATOMIC_AAF(&io_count_, io_count);
   ATOMIC_AAF(&io_bytes_, io_bytes);
   ATOMIC_AAF(&io_rt_us_, io_rt_us);
+  // io_rt_us is the sum of the batch, bucket the batch by its mean rt
+  const uint64_t avg_rt_us = io_count > 0 ? io_rt_us / io_count : io_rt_us;
+  ATOMIC_AAF(&rt_hist_[get_rt_bucket(avg_rt_us)], io_count);
 }
 
 void ObIOStat::reset()
@@ -378,6 +381,13 @@ void ObIOStat::reset()
   io_count_ = 0;
   io_bytes_ = 0;
   io_rt_us_ = 0;
+  MEMSET(rt_hist_, 0, sizeof(rt_hist_));
+}
+
+int64_t ObIOStat::get_rt_bucket(const uint64_t io_rt_us)
+{
+  const int64_t bucket = io_rt_us > 0 ? 63 - __builtin_clzll(io_rt_us) : 0;
+  return bucket < RT_HIST_BUCKET_CNT ? bucket : RT_HIST_BUCKET_CNT - 1;
 }
 
 /******************             IOStatDiff              **********************/
@@ -394,7 +404,7 @@ ObIOStatDiff::~ObIOStatDiff()
 
 }
 
-void ObIOStatDiff::diff(const ObIOStat &io_stat, double &avg_iops, double &avg_bytes, double &avg_rt_us)
+void ObIOStatDiff::diff(const ObIOStat &io_stat, double &avg_iops, double &avg_bytes, double &avg_rt_us, double &p99_rt_us)
 {
   const int64_t new_ts = ObTimeUtility::fast_current_time();
   const ObIOStat new_stat = io_stat; // copy to prevent accumulating
@@ -402,9 +412,26 @@ void ObIOStatDiff::diff(const ObIOStat &io_stat, double &avg_iops, double &avg_b
   if (delta_io_count > 0) {
     avg_bytes = 1.0 * (new_stat.io_bytes_ - last_stat_.io_bytes_) / delta_io_count;
     avg_rt_us = 1.0 * (new_stat.io_rt_us_ - last_stat_.io_rt_us_) / delta_io_count;
+    // report the upper bound of the bucket where 99% of io of this period is reached,
+    // the histogram is not updated with io_count_ atomically so sum it up again here
+    int64_t hist_count = 0;
+    for (int64_t i = 0; i < ObIOStat::RT_HIST_BUCKET_CNT; ++i) {
+      hist_count += new_stat.rt_hist_[i] - last_stat_.rt_hist_[i];
+    }
+    const int64_t p99_count = hist_count - hist_count / 100;
+    int64_t acc_count = 0;
+    p99_rt_us = 0;
+    for (int64_t i = 0; i < ObIOStat::RT_HIST_BUCKET_CNT && hist_count > 0; ++i) {
+      acc_count += new_stat.rt_hist_[i] - last_stat_.rt_hist_[i];
+      if (acc_count >= p99_count) {
+        p99_rt_us = static_cast<double>(1L << (i + 1));
+        break;
+      }
+    }
   } else {
     avg_bytes = 0;
     avg_rt_us = 0;
+    p99_rt_us = 0;
   }
   if (last_ts_ > 0 && new_ts > last_ts_) {
     const double delta_interval_s = 1.0 * (new_ts - last_ts_) / (1000L * 1000L);
@@ -425,6 +452,7 @@ void ObIOStatDiff::reset()
 /******************             IOUsage              **********************/
 ObIOUsage::ObIOUsage()
 {
+  MEMSET(p99_rt_us_, 0, sizeof(p99_rt_us_));
   MEMSET(doing_request_count_, 0, sizeof(doing_request_count_));
 }
 
@@ -448,7 +476,7 @@ void ObIOUsage::calculate_io_usage()
     for (int64_t j = 0; j < static_cast<int>(ObIOMode::MAX_MODE); ++j) {
       ObIOStatDiff &cur_io_estimator = io_estimators_[i][j];
       ObIOStat &cur_io_stat = io_stats_[i][j];
-      cur_io_estimator.diff(cur_io_stat, avg_iops_[i][j], avg_byte_[i][j], avg_rt_us_[i][j]);
+      cur_io_estimator.diff(cur_io_stat, avg_iops_[i][j], avg_byte_[i][j], avg_rt_us_[i][j], p99_rt_us_[i][j]);
     }
   }
 }
@@ -460,6 +488,11 @@ void ObIOUsage::get_io_usage(AvgItems &avg_iops, AvgItems &avg_bytes, AvgItems &
   memcpy(&avg_rt_us, &avg_rt_us_, sizeof(AvgItems));
 }
 
+void ObIOUsage::get_io_rt_p99(AvgItems &p99_rt_us) const
+{
+  memcpy(&p99_rt_us, &p99_rt_us_, sizeof(AvgItems));
+}
+
 void ObIOUsage::record_request_start(const ObIORequest &req)
 {
   ATOMIC_INC(&doing_request_count_[static_cast<int>(req.get_category())]);
@@ -112,14 +112,19 @@ struct ObIOStat final
 public:
   ObIOStat();
   ~ObIOStat();
+  // io_bytes and io_rt_us are the totals of io_count io
   void accumulate(const uint64_t io_count, const uint64_t io_bytes, const uint64_t io_rt_us);
   void reset();
+  // bucket i counts io whose rt is in [2^i, 2^(i+1)) us, the last one holds all slower io
+  static int64_t get_rt_bucket(const uint64_t io_rt_us);
   TO_STRING_KV(K(io_count_), K(io_bytes_), K(io_rt_us_));
 
 public:
+  static const int64_t RT_HIST_BUCKET_CNT = 24;
   uint64_t io_count_;
   uint64_t io_bytes_;
   uint64_t io_rt_us_;
+  uint64_t rt_hist_[RT_HIST_BUCKET_CNT];
 };
 
 class ObIOStatDiff final
@@ -127,7 +132,7 @@ class ObIOStatDiff final
 public:
   ObIOStatDiff();
   ~ObIOStatDiff();
-  void diff(const ObIOStat &io_stat, double &avg_iops, double &avg_bytes, double &avg_rt_us);
+  void diff(const ObIOStat &io_stat, double &avg_iops, double &avg_bytes, double &avg_rt_us, double &p99_rt_us);
   void reset();
   TO_STRING_KV(K(last_stat_), K(last_ts_));
 private:
@@ -144,6 +149,7 @@ public:
   void calculate_io_usage();
   typedef double AvgItems[static_cast<int>(ObIOCategory::MAX_CATEGORY)][static_cast<int>(ObIOMode::MAX_MODE)];
   void get_io_usage(AvgItems &avg_iops, AvgItems &avg_bytes, AvgItems &avg_rt_us) const;
+  void get_io_rt_p99(AvgItems &p99_rt_us) const;
   void record_request_start(const ObIORequest &req);
   void record_request_finish(const ObIORequest &req);
   bool is_request_doing(const ObIOCategory category) const;
@@ -154,6 +160,7 @@ private:
   AvgItems avg_iops_;
   AvgItems avg_byte_;
   AvgItems avg_rt_us_;
+  AvgItems p99_rt_us_;
   int64_t doing_request_count_[static_cast<int>(ObIOCategory::MAX_CATEGORY)];
 };
 
@@ -236,6 +236,10 @@ DEF_CAP(_hash_area_size, OB_TENANT_PARAMETER, "100M", "[4M,]",
 DEF_BOOL(_enable_partition_level_retry, OB_CLUSTER_PARAMETER, "True",
          "specifies whether allow the partition level retry when the leader changes",
          ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_BOOL(_enable_das_parallel_dispatch, OB_CLUSTER_PARAMETER, "False",
+         "specifies whether das tasks of one statement on different servers are sent together "
+         "with async rpc instead of one after another",
+         ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 //https://yuque.antfin-inc.com/ob/product_functionality_review/zlp56c
 DEF_INT_WITH_CHECKER(_enable_defensive_check, OB_CLUSTER_PARAMETER, "1",
                      common::ObConfigEnableDefensiveChecker,
@@ -1083,7 +1087,7 @@ DEF_BOOL(_bloom_filter_enabled, OB_TENANT_PARAMETER, "True",
 DEF_STR_WITH_CHECKER(use_large_pages, OB_CLUSTER_PARAMETER, "false",
                      common::ObConfigUseLargePagesChecker,
                      "used to manage the database's use of large pages, "
-                     "values: false, true, only",
+                     "values: false, true, only, transparent",
                      ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::STATIC_EFFECTIVE));
 
 DEF_STR(ob_ssl_invited_common_names, OB_TENANT_PARAMETER, "NONE",
@@ -1312,6 +1316,31 @@ ERRSIM_DEF_STR(errsim_migration_src_server_addr, OB_CLUSTER_PARAMETER, "",
 DEF_BOOL(enable_cgroup, OB_CLUSTER_PARAMETER, "True",
          "when set to false, cgroup will not init; when set to true but cgroup root dir is not ready, print ERROR",
          ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::STATIC_EFFECTIVE));
+DEF_BOOL(_enable_cpu_profiler, OB_CLUSTER_PARAMETER, "False",
+         "when set to true, on-cpu stacks are sampled at 100Hz and the hottest ones of each "
+         "tenant, sql_id and plan line are reported to the log every minute",
+         ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_BOOL(_enable_numa_aware_placement, OB_CLUSTER_PARAMETER, "False",
+         "when set to true, tenant workers are bound to the cpus of one numa node, "
+         "so the memory they touch first is allocated from that node",
+         ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::STATIC_EFFECTIVE));
+DEF_DBL(_optimizer_cpu_cost_scale, OB_CLUSTER_PARAMETER, "1", "[0.01,100]",
+        "ratio applied to the cpu costs of the optimizer cost model, such as compare, hash, "
+        "project and per row operator costs, to match the cpu of this server. Range: [0.01,100]",
+        ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_DBL(_optimizer_seq_io_cost_scale, OB_CLUSTER_PARAMETER, "1", "[0.01,100]",
+        "ratio applied to the cost of reading a micro block sequentially in the optimizer "
+        "cost model, to match the storage of this server. Range: [0.01,100]",
+        ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_DBL(_optimizer_rnd_io_cost_scale, OB_CLUSTER_PARAMETER, "1", "[0.01,100]",
+        "ratio applied to the costs of random micro block reads, row fetches and nested loop "
+        "rescans in the optimizer cost model, to match the storage of this server. Range: [0.01,100]",
+        ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_BOOL(_enable_cardinality_feedback, OB_CLUSTER_PARAMETER, "False",
+         "when set to true, a cached plan is expired if the rows materialized by a sort, material, "
+         "hash join build or temp table exceed the estimated rows by orders of magnitude, "
+         "so that the next execution optimizes the statement again",
+         ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 DEF_TIME(_ob_plan_cache_auto_flush_interval, OB_CLUSTER_PARAMETER, "0s", "[0s,)",
          "time interval for auto periodic flush plan cache. Range: [0s, +∞)",
          ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
\ No newline at end of file
@@ -214,9 +214,15 @@ bool ObDASRef::is_all_local_task() const
 int ObDASRef::execute_all_task()
 {
   int ret = OB_SUCCESS;
-  bool DAS_TASK_AGGREGATION = false;
-  if (DAS_TASK_AGGREGATION) {
-    // TODO(roland.qk): DAS task aggregation.
+  // runners without the async das access rpc reject it before running the
+  // task, parallel_execute_das_task then sends their tasks with the sync rpc
+  const bool parallel_dispatch = !is_execute_directly()
+                                 && get_das_task_cnt() > 1
+                                 && GCONF._enable_das_parallel_dispatch;
+  if (parallel_dispatch) {
+    if (OB_FAIL(MTL(ObDataAccessService*)->parallel_execute_das_task(*this))) {
+      LOG_WARN("parallel execute das task failed", K(ret));
+    }
   } else {
     DASTaskIter task_iter = begin_task_iter();
     while (OB_SUCC(ret) && !task_iter.is_end()) {
@@ -21,11 +21,12 @@ namespace oceanbase
 {
 namespace sql
 {
-int ObDASSyncAccessP::init()
+template <obrpc::ObRpcPacketCode pcode>
+int ObDASBaseAccessP<pcode>::init()
 {
   int ret = OB_SUCCESS;
-  ObDASTaskArg &task = arg_;
-  ObDASSyncAccessP::get_das_factory() = &das_factory_;
+  ObDASTaskArg &task = RpcProcessor::arg_;
+  get_das_factory() = &das_factory_;
   das_remote_info_.exec_ctx_ = &exec_ctx_;
   das_remote_info_.frame_info_ = &frame_info_;
   task.set_remote_info(&das_remote_info_);
@@ -33,21 +34,22 @@ int ObDASSyncAccessP::init()
   return ret;
 }
 
-int ObDASSyncAccessP::before_process()
+template <obrpc::ObRpcPacketCode pcode>
+int ObDASBaseAccessP<pcode>::before_process()
 {
   int ret = OB_SUCCESS;
-  ObDASTaskArg &task = arg_;
-  ObDASTaskResp &task_resp = result_;
+  ObDASTaskArg &task = RpcProcessor::arg_;
+  ObDASTaskResp &task_resp = RpcProcessor::result_;
   ObIDASTaskResult *task_result = nullptr;
   ObMemAttr mem_attr;
   mem_attr.tenant_id_ = task.get_task_op()->get_tenant_id();
   mem_attr.label_ = "DASRpcPCtx";
   exec_ctx_.get_allocator().set_attr(mem_attr);
-  ObDASTaskFactory *das_factory = ObDASSyncAccessP::get_das_factory();
+  ObDASTaskFactory *das_factory = get_das_factory();
   if (OB_ISNULL(das_factory)) {
     ret = OB_ERR_UNEXPECTED;
     LOG_WARN("das factory is not inited", K(ret));
-  } else if (OB_FAIL(ObDASSyncRpcProcessor::before_process())) {
+  } else if (OB_FAIL(RpcProcessor::before_process())) {
     LOG_WARN("do rpc processor before_process failed", K(ret));
   } else if (das_remote_info_.need_calc_udf_ &&
       OB_FAIL(GCTX.schema_service_->get_tenant_schema_guard(MTL_ID(), schema_guard_))) {
@@ -65,13 +67,14 @@ int ObDASSyncAccessP::before_process()
   return ret;
 }
 
-int ObDASSyncAccessP::process()
+template <obrpc::ObRpcPacketCode pcode>
+int ObDASBaseAccessP<pcode>::process()
 {
   int ret = OB_SUCCESS;
   NG_TRACE(das_rpc_process_begin);
   FLTSpanGuard(das_rpc_process);
-  ObDASTaskArg &task = arg_;
-  ObDASTaskResp &task_resp = result_;
+  ObDASTaskArg &task = RpcProcessor::arg_;
+  ObDASTaskResp &task_resp = RpcProcessor::result_;
   ObIDASTaskOp *task_op = task.get_task_op();
   ObIDASTaskResult *task_result = task_resp.get_op_result();
   bool has_more = false;
@@ -130,11 +133,12 @@ int ObDASSyncAccessP::process()
   return OB_SUCCESS;
 }
 
-int ObDASSyncAccessP::after_process(int error_code)
+template <obrpc::ObRpcPacketCode pcode>
+int ObDASBaseAccessP<pcode>::after_process(int error_code)
 {
   int ret = OB_SUCCESS;
-  const int64_t elapsed_time = common::ObTimeUtility::current_time() - get_receive_timestamp();
-  if (OB_FAIL(ObDASSyncRpcProcessor::after_process(error_code))) {
+  const int64_t elapsed_time = common::ObTimeUtility::current_time() - RpcProcessor::get_receive_timestamp();
+  if (OB_FAIL(RpcProcessor::after_process(error_code))) {
     LOG_WARN("do das sync base rpc process failed", K(ret));
   } else if (elapsed_time >= ObServerConfig::get_instance().trace_log_slow_query_watermark) {
     //slow das task, print trace info
@@ -144,18 +148,22 @@ int ObDASSyncAccessP::after_process(int error_code)
   return OB_SUCCESS;
 }
 
-void ObDASSyncAccessP::cleanup()
+template <obrpc::ObRpcPacketCode pcode>
+void ObDASBaseAccessP<pcode>::cleanup()
 {
   ObActiveSessionGuard::setup_default_ash();
   das_factory_.cleanup();
-  ObDASSyncAccessP::get_das_factory() = nullptr;
+  get_das_factory() = nullptr;
   if (das_remote_info_.trans_desc_ != nullptr) {
     MTL(transaction::ObTransService*)->release_tx(*das_remote_info_.trans_desc_);
     das_remote_info_.trans_desc_ = nullptr;
   }
-  ObDASSyncRpcProcessor::cleanup();
+  RpcProcessor::cleanup();
 }
 
+template class ObDASBaseAccessP<obrpc::OB_DAS_SYNC_ACCESS>;
+template class ObDASBaseAccessP<obrpc::OB_DAS_ASYNC_ACCESS>;
+
 int ObDASSyncFetchP::process()
 {
   int ret = OB_SUCCESS;
@@ -29,23 +29,34 @@ struct ObGlobalContext;
 }
 namespace sql
 {
-typedef obrpc::ObRpcProcessor<obrpc::ObDASRpcProxy::ObRpc<obrpc::OB_DAS_SYNC_ACCESS> > ObDASSyncRpcProcessor;
 typedef obrpc::ObRpcProcessor<obrpc::ObDASRpcProxy::ObRpc<obrpc::OB_DAS_SYNC_FETCH_RESULT> > ObDASSyncFetchResRpcProcessor;
 typedef obrpc::ObRpcProcessor<obrpc::ObDASRpcProxy::ObRpc<obrpc::OB_DAS_ASYNC_ERASE_RESULT> > ObDASAsyncEraseResRpcProcessor;
 
-class ObDASSyncAccessP : public ObDASSyncRpcProcessor
+// factory the das task arg being decoded allocates its ops from, shared by
+// the sync and the async access processor
+OB_INLINE ObDASTaskFactory *&get_das_access_factory()
 {
+  RLOCAL_INLINE(ObDASTaskFactory*, g_das_fatory);
+  return g_das_fatory;
+}
+
+// the sync and the async access only differ in how the controller waits
+// for the response, both are executed by this processor
+template <obrpc::ObRpcPacketCode pcode>
+class ObDASBaseAccessP : public obrpc::ObRpcProcessor<obrpc::ObDASRpcProxy::ObRpc<pcode> >
+{
+  typedef obrpc::ObRpcProcessor<obrpc::ObDASRpcProxy::ObRpc<pcode> > RpcProcessor;
 public:
-  ObDASSyncAccessP(const observer::ObGlobalContext &gctx)
+  ObDASBaseAccessP(const observer::ObGlobalContext &gctx)
     : das_factory_(CURRENT_CONTEXT->get_arena_allocator()),
       exec_ctx_(CURRENT_CONTEXT->get_arena_allocator(), gctx.session_mgr_),
       frame_info_(CURRENT_CONTEXT->get_arena_allocator()),
       das_remote_info_()
   {
-    set_preserve_recv_data();
+    RpcProcessor::set_preserve_recv_data();
   }
 
-  virtual ~ObDASSyncAccessP() {}
+  virtual ~ObDASBaseAccessP() {}
   virtual int init();
   virtual int before_process();
   virtual int process();
@@ -53,8 +64,7 @@ public:
   virtual void cleanup() override;
   static ObDASTaskFactory *&get_das_factory()
   {
-    RLOCAL(ObDASTaskFactory*, g_das_fatory);
-    return g_das_fatory;
+    return get_das_access_factory();
   }
 private:
   ObDASTaskFactory das_factory_;
@@ -64,6 +74,9 @@ private:
   ObDASRemoteInfo das_remote_info_;
 };
 
+typedef ObDASBaseAccessP<obrpc::OB_DAS_SYNC_ACCESS> ObDASSyncAccessP;
+typedef ObDASBaseAccessP<obrpc::OB_DAS_ASYNC_ACCESS> ObDASAsyncAccessP;
+
 class ObDASSyncFetchP : public ObDASSyncFetchResRpcProcessor
 {
 public:
@@ -79,7 +79,7 @@ OB_DEF_DESERIALIZE(ObDASRemoteInfo)
   int ctdef_cnt = 0;
   int rtdef_cnt = 0;
   ObEvalCtx *eval_ctx = nullptr;
-  ObDASTaskFactory *das_factory = ObDASSyncAccessP::get_das_factory();
+  ObDASTaskFactory *das_factory = get_das_access_factory();
 #if !defined(NDEBUG)
   CK(typeid(*exec_ctx_) == typeid(ObDesExecContext));
 #endif
@@ -252,7 +252,7 @@ OB_DEF_DESERIALIZE(ObDASTaskArg)
   ObDASOpType op_type = DAS_OP_INVALID;
   int64_t count = 0;
   ObIDASTaskOp *task_op = nullptr;
-  ObDASTaskFactory *das_factory = ObDASSyncAccessP::get_das_factory();
+  ObDASTaskFactory *das_factory = get_das_access_factory();
   CK(OB_NOT_NULL(das_factory));
   LST_DO_CODE(OB_UNIS_DECODE,
               timeout_ts_,
@@ -17,6 +17,7 @@
 #include "storage/tx/ob_trans_define.h"
 #include "storage/tx/ob_clog_encrypt_info.h"
 #include "rpc/obrpc/ob_rpc_result_code.h"
+#include "rpc/obrpc/ob_rpc_packet.h"
 #include "sql/das/ob_das_define.h"
 #include "storage/access/ob_dml_param.h"
 #include "sql/engine/basic/ob_chunk_datum_store.h"
@@ -34,6 +35,7 @@ class ObIDASTaskResult;
 class ObDASExtraData;
 class ObExprFrameInfo;
 class ObDASScanOp;
+template <obrpc::ObRpcPacketCode pcode> class ObDASBaseAccessP;
 
 struct ObDASRemoteInfo
 {
@@ -78,7 +80,7 @@ public:
 class ObIDASTaskOp
 {
   friend class ObDataAccessService;
-  friend class ObDASSyncAccessP;
+  template <obrpc::ObRpcPacketCode pcode> friend class ObDASBaseAccessP;
   friend class ObDASRef;
   OB_UNIS_VERSION_V(1);
 public:
@@ -85,6 +85,13 @@ int ObDataAccessService::execute_das_task(ObDASRef &das_ref, ObIDASTaskOp &task_
     task_op.errcode_ = ret;
   }
   OB_ASSERT(task_op.errcode_ == ret);
+  ret = process_das_task_ret(das_ref, task_op);
+  return ret;
+}
+
+int ObDataAccessService::process_das_task_ret(ObDASRef &das_ref, ObIDASTaskOp &task_op)
+{
+  int ret = task_op.errcode_;
   if (OB_FAIL(ret) && GCONF._enable_partition_level_retry && task_op.can_part_retry()) {
     //only fast select can be retry with partition level
     int tmp_ret = retry_das_task(das_ref, task_op);
@@ -97,6 +104,237 @@ int ObDataAccessService::execute_das_task(ObDASRef &das_ref, ObIDASTaskOp &task_
   return ret;
 }
 
+int ObDataAccessService::parallel_execute_das_task(ObDASRef &das_ref)
+{
+  int ret = OB_SUCCESS;
+  ObSEArray<ObIDASTaskOp*, 16> pending_tasks;
+  ObSEArray<ObIDASTaskOp*, 16> next_tasks;
+  ObSEArray<ObIDASTaskOp*, 8> sync_tasks;
+  ObSEArray<ObIDASTaskOp*, 8> async_tasks;
+  ObSEArray<ObDASAsyncAccessCB*, 8> cbs;
+  // servers which rejected the async rpc, the rest of their tasks use the sync one
+  ObSEArray<ObAddr, 4> sync_svrs;
+  ObThreadCond cond;
+  if (OB_FAIL(cond.init(ObWaitEventIds::DEFAULT_COND_WAIT))) {
+    LOG_WARN("init das async cond failed", K(ret));
+  }
+  for (DASTaskIter task_iter = das_ref.begin_task_iter();
+       OB_SUCC(ret) && !task_iter.is_end(); ++task_iter) {
+    if (OB_FAIL(pending_tasks.push_back(*task_iter))) {
+      LOG_WARN("store pending das task failed", K(ret));
+    }
+  }
+  while (OB_SUCC(ret) && !pending_tasks.empty()) {
+    cbs.reuse();
+    if (OB_FAIL(split_das_task_wave(ctrl_addr_, sync_svrs, pending_tasks,
+                                    sync_tasks, async_tasks, next_tasks))) {
+      LOG_WARN("split das task wave failed", K(ret));
+    }
+    for (int64_t i = 0; OB_SUCC(ret) && i < async_tasks.count(); ++i) {
+      ObIDASTaskOp *task_op = async_tasks.at(i);
+      void *buf = das_ref.get_das_alloc().alloc(sizeof(ObDASAsyncAccessCB));
+      if (OB_ISNULL(buf)) {
+        ret = OB_ALLOCATE_MEMORY_FAILED;
+        LOG_WARN("allocate das async callback failed", K(ret));
+      } else {
+        ObDASAsyncAccessCB *cb = new (buf) ObDASAsyncAccessCB(cond, *task_op);
+        if (OB_FAIL(cbs.push_back(cb))) {
+          LOG_WARN("store das async callback failed", K(ret));
+          cb->~ObDASAsyncAccessCB();
+        } else {
+          int tmp_ret = send_async_das_task(das_ref, *task_op, *cb);
+          if (OB_SUCCESS != tmp_ret) {
+            // handled like a failed response, so the task can still be retried
+            cb->finish(tmp_ret);
+          }
+        }
+      }
+    }
+    // run the local tasks while the remote ones are in flight
+    for (int64_t i = 0; OB_SUCC(ret) && i < sync_tasks.count(); ++i) {
+      if (OB_FAIL(execute_das_task(das_ref, *sync_tasks.at(i)))) {
+        LOG_WARN("execute das task failed", K(ret));
+      }
+    }
+    // the callbacks reference cond and the task ops, wait for all of them
+    // even if something went wrong above
+    wait_async_das_task(cond, cbs);
+    ret = process_async_das_resps(das_ref, cbs, sync_svrs, ret);
+    if (OB_SUCC(ret) && OB_FAIL(pending_tasks.assign(next_tasks))) {
+      LOG_WARN("assign pending das tasks failed", K(ret));
+    }
+  }
+  return ret;
+}
+
+int ObDataAccessService::split_das_task_wave(const ObAddr &ctrl_addr,
+                                             const ObIArray<ObAddr> &sync_svrs,
+                                             const ObIArray<ObIDASTaskOp*> &pending_tasks,
+                                             ObIArray<ObIDASTaskOp*> &sync_tasks,
+                                             ObIArray<ObIDASTaskOp*> &async_tasks,
+                                             ObIArray<ObIDASTaskOp*> &next_tasks)
+{
+  int ret = OB_SUCCESS;
+  sync_tasks.reuse();
+  async_tasks.reuse();
+  next_tasks.reuse();
+  // Each wave sends at most one task to every remote server, so the tasks
+  // of one server are still executed in their original order.
+  for (int64_t i = 0; OB_SUCC(ret) && i < pending_tasks.count(); ++i) {
+    ObIDASTaskOp *task_op = pending_tasks.at(i);
+    const ObAddr &svr = task_op->get_tablet_loc()->server_;
+    bool svr_in_wave = false;
+    for (int64_t j = 0; !svr_in_wave && j < async_tasks.count(); ++j) {
+      svr_in_wave = (async_tasks.at(j)->get_tablet_loc()->server_ == svr);
+    }
+    if (svr == ctrl_addr || has_exist_in_array(sync_svrs, svr)) {
+      ret = sync_tasks.push_back(task_op);
+    } else if (svr_in_wave) {
+      ret = next_tasks.push_back(task_op);
+    } else {
+      ret = async_tasks.push_back(task_op);
+    }
+    if (OB_FAIL(ret)) {
+      LOG_WARN("store das task of wave failed", K(ret));
+    }
+  }
+  return ret;
+}
+
+int ObDataAccessService::send_async_das_task(ObDASRef &das_ref,
+                                             ObIDASTaskOp &task_op,
+                                             ObDASAsyncAccessCB &cb)
+{
+  int ret = OB_SUCCESS;
+  ObSQLSessionInfo *session = das_ref.get_exec_ctx().get_my_session();
+  ObPhysicalPlanCtx *plan_ctx = das_ref.get_exec_ctx().get_physical_plan_ctx();
+  int64_t timeout = plan_ctx->get_timeout_timestamp() - ObTimeUtility::current_time();
+  uint64_t tenant_id = session->get_rpc_tenant_id();
+  ObIDASTaskResult *op_result = nullptr;
+  ObDASTaskArg task_arg;
+  ObDASRemoteInfo remote_info;
+  remote_info.exec_ctx_ = &das_ref.get_exec_ctx();
+  remote_info.frame_info_ = das_ref.get_expr_frame_info();
+  remote_info.trans_desc_ = session->get_tx_desc();
+  remote_info.snapshot_ = *task_op.get_snapshot();
+  remote_info.need_tx_ = (remote_info.trans_desc_ != nullptr);
+  task_arg.set_remote_info(&remote_info);
+  ObDASRemoteInfo::get_remote_info() = &remote_info;
+  if (OB_FAIL(task_arg.add_task_op(&task_op))) {
+    LOG_WARN("failed to add das task op", K(ret), K(task_op));
+  } else if (FALSE_IT(task_arg.set_timeout_ts(session->get_query_timeout_ts()))) {
+  } else if (FALSE_IT(task_arg.set_ctrl_svr(ctrl_addr_))) {
+  } else if (FALSE_IT(task_arg.get_runner_svr() = task_op.tablet_loc_->server_)) {
+  } else if (OB_FAIL(collect_das_task_info(task_arg, remote_info))) {
+    LOG_WARN("collect das task info failed", K(ret));
+  } else if (OB_FAIL(das_ref.get_das_factory().create_das_task_result(task_op.get_type(), op_result))) {
+    LOG_WARN("create das task result failed", K(ret));
+  } else if (OB_FAIL(op_result->init(task_op))) {
+    LOG_WARN("init task result failed", K(ret));
+  } else if (OB_FAIL(cb.get_task_resp().add_op_result(op_result))) {
+    LOG_WARN("failed to add op result", K(ret));
+  } else if (OB_UNLIKELY(timeout <= 0)) {
+    ret = OB_TIMEOUT;
+    LOG_WARN("das is timeout", K(ret), K(plan_ctx->get_timeout_timestamp()), K(timeout));
+  } else if (OB_FAIL(das_rpc_proxy_
+                     .to(task_arg.get_runner_svr())
+                     .by(tenant_id)
+                     .timeout(timeout)
+                     .async_access(task_arg, &cb))) {
+    LOG_WARN("rpc remote async access failed", K(ret), K(task_arg));
+  }
+  return ret;
+}
+
+void ObDataAccessService::wait_async_das_task(ObThreadCond &cond,
+                                              const ObIArray<ObDASAsyncAccessCB*> &cbs)
+{
+  // every callback sent is finished by the rpc framework at the latest when
+  // its timeout, which is the query timeout, is reached
+  ObThreadCondGuard guard(cond);
+  bool all_done = false;
+  while (!all_done) {
+    all_done = true;
+    for (int64_t i = 0; all_done && i < cbs.count(); ++i) {
+      all_done = cbs.at(i)->is_done();
+    }
+    if (!all_done) {
+      (void)cond.wait_us(500);
+    }
+  }
+}
+
+int ObDataAccessService::process_async_das_resp(ObDASRef &das_ref, ObDASAsyncAccessCB &cb)
+{
+  int ret = OB_SUCCESS;
+  ObIDASTaskOp &task_op = cb.get_task_op();
+  ObSQLSessionInfo *session = das_ref.get_exec_ctx().get_my_session();
+  if (OB_NOT_SUPPORTED == cb.get_rpc_ret()) {
+    // the runner does not know OB_DAS_ASYNC_ACCESS and rejected it before
+    // the task started, so it is safe to send the task again with the sync rpc
+    LOG_INFO("runner does not support das async access, use sync rpc",
+             "runner", task_op.get_tablet_loc()->server_);
+    ret = execute_dist_das_task(das_ref, task_op);
+  } else if (OB_FAIL(cb.get_rpc_ret())) {
+    LOG_WARN("rpc remote async access failed", K(ret), K(task_op));
+    // RPC fail, add task's LSID to trans_result
+    // indicate some transaction participant may touched
+    session->get_trans_result().add_touched_ls(task_op.get_ls_id());
+  } else if (OB_FAIL(process_remote_task_resp(das_ref, task_op,
+                                              *cb.get_task_resp().get_op_result(),
+                                              cb.get_task_resp()))) {
+    LOG_WARN("process remote das task response failed", K(ret));
+  }
+  task_op.errcode_ = ret;
+  ret = process_das_task_ret(das_ref, task_op);
+  return ret;
+}
+
+int ObDataAccessService::process_async_das_resps(ObDASRef &das_ref,
+                                                 const ObIArray<ObDASAsyncAccessCB*> &cbs,
+                                                 ObIArray<ObAddr> &sync_svrs,
+                                                 const int last_ret)
+{
+  int ret = last_ret;
+  for (int64_t i = 0; i < cbs.count(); ++i) {
+    ObDASAsyncAccessCB *cb = cbs.at(i);
+    if (OB_NOT_SUPPORTED == cb->get_rpc_ret()) {
+      int tmp_ret = add_var_to_array_no_dup(sync_svrs, cb->get_task_op().get_tablet_loc()->server_);
+      if (OB_SUCCESS != tmp_ret) {
+        LOG_WARN("store sync das server failed", K(tmp_ret));
+        ret = COVER_SUCC(tmp_ret);
+      }
+    }
+    if (OB_FAIL(ret)) {
+      // the statement fails anyway, but the tasks of the other servers may have
+      // touched participants the transaction has to know for rollback and commit
+      merge_async_das_trans_result(das_ref, *cb);
+    } else if (OB_FAIL(process_async_das_resp(das_ref, *cb))) {
+      LOG_WARN("process das async response failed", K(ret), KPC(cb));
+    }
+    cb->~ObDASAsyncAccessCB();
+  }
+  return ret;
+}
+
+void ObDataAccessService::merge_async_das_trans_result(ObDASRef &das_ref, ObDASAsyncAccessCB &cb)
+{
+  ObIDASTaskOp &task_op = cb.get_task_op();
+  ObSQLSessionInfo *session = das_ref.get_exec_ctx().get_my_session();
+  if (OB_NOT_SUPPORTED == cb.get_rpc_ret()) {
+    // rejected by the runner before the task started
+  } else if (OB_SUCCESS != cb.get_rpc_ret()) {
+    session->get_trans_result().add_touched_ls(task_op.get_ls_id());
+  } else if (OB_NOT_NULL(session->get_tx_desc())) {
+    int tmp_ret = MTL(transaction::ObTransService*)
+      ->add_tx_exec_result(*session->get_tx_desc(),
+                           cb.get_task_resp().get_trans_result());
+    if (OB_SUCCESS != tmp_ret) {
+      LOG_WARN("merge response partition failed", K(tmp_ret), K(cb.get_task_resp()));
+    }
+  }
+}
+
 int ObDataAccessService::get_das_task_id(int64_t &das_id)
 {
   int ret = OB_SUCCESS;
@@ -295,7 +533,6 @@ int ObDataAccessService::do_remote_das_task(ObDASRef &das_ref, ObDASTaskArg &tas
   uint64_t tenant_id = session->get_rpc_tenant_id();
   ObIDASTaskOp *task_op = task_arg.get_task_op();
   ObIDASTaskResult *op_result = nullptr;
-  ObDASExtraData *extra_result = nullptr;
   ObDASRemoteInfo remote_info;
   remote_info.exec_ctx_ = &das_ref.get_exec_ctx();
   remote_info.frame_info_ = das_ref.get_expr_frame_info();
@@ -327,34 +564,46 @@ int ObDataAccessService::do_remote_das_task(ObDASRef &das_ref, ObDASTaskArg &tas
       // RPC fail, add task's LSID to trans_result
       // indicate some transaction participant may touched
       session->get_trans_result().add_touched_ls(task_op->get_ls_id());
-    } else {
-      ObDASUtils::log_user_error_and_warn(task_resp.get_rcode());
-      if (OB_FAIL(task_resp.get_err_code())) {
-        LOG_WARN("error occurring in remote das task", K(ret), K(task_arg));
-      } else if (OB_FAIL(task_op->decode_task_result(op_result))) {
-        LOG_WARN("decode das task result failed", K(ret));
-      } else if (task_resp.has_more()
-                  && OB_FAIL(setup_extra_result(das_ref, task_resp,
-                  task_op, extra_result))) {
-        LOG_WARN("setup extra result failed", KR(ret));
-      } else if (task_resp.has_more() && OB_FAIL(op_result->link_extra_result(*extra_result))) {
-        LOG_WARN("link extra result failed", K(ret));
-      }
-      if (OB_NOT_NULL(session->get_tx_desc())) {
-        int tmp_ret = MTL(transaction::ObTransService*)
-          ->add_tx_exec_result(*session->get_tx_desc(),
-                                task_resp.get_trans_result());
-        if (tmp_ret != OB_SUCCESS) {
-          LOG_WARN("merge response partition failed", K(ret), K(tmp_ret), K(task_resp));
-        }
-        ret = COVER_SUCC(tmp_ret);
-      }
+    } else if (OB_FAIL(process_remote_task_resp(das_ref, *task_op, *op_result, task_resp))) {
+      LOG_WARN("process remote das task response failed", K(ret), K(task_arg));
     }
   }
   NG_TRACE_EXT(do_remote_das_task_end, Y(ret), OB_ID(addr), task_arg.get_runner_svr());
   return ret;
 }
 
+int ObDataAccessService::process_remote_task_resp(ObDASRef &das_ref,
+                                                  ObIDASTaskOp &task_op,
+                                                  ObIDASTaskResult &op_result,
+                                                  ObDASTaskResp &task_resp)
+{
+  int ret = OB_SUCCESS;
+  ObSQLSessionInfo *session = das_ref.get_exec_ctx().get_my_session();
+  ObDASExtraData *extra_result = nullptr;
+  ObDASUtils::log_user_error_and_warn(task_resp.get_rcode());
+  if (OB_FAIL(task_resp.get_err_code())) {
+    LOG_WARN("error occurring in remote das task", K(ret), K(task_op));
+  } else if (OB_FAIL(task_op.decode_task_result(&op_result))) {
+    LOG_WARN("decode das task result failed", K(ret));
+  } else if (task_resp.has_more()
+              && OB_FAIL(setup_extra_result(das_ref, task_resp,
+              &task_op, extra_result))) {
+    LOG_WARN("setup extra result failed", KR(ret));
+  } else if (task_resp.has_more() && OB_FAIL(op_result.link_extra_result(*extra_result))) {
+    LOG_WARN("link extra result failed", K(ret));
+  }
+  if (OB_NOT_NULL(session->get_tx_desc())) {
+    int tmp_ret = MTL(transaction::ObTransService*)
+      ->add_tx_exec_result(*session->get_tx_desc(),
+                            task_resp.get_trans_result());
+    if (tmp_ret != OB_SUCCESS) {
+      LOG_WARN("merge response partition failed", K(ret), K(tmp_ret), K(task_resp));
+    }
+    ret = COVER_SUCC(tmp_ret);
+  }
+  return ret;
+}
+
 int ObDataAccessService::collect_das_task_info(ObDASTaskArg &task_arg, ObDASRemoteInfo &remote_info)
 {
   int ret = OB_SUCCESS;
@@ -406,5 +655,52 @@ int ObDataAccessService::setup_extra_result(ObDASRef &das_ref,
   }
   return ret;
 }
+
+int ObDASAsyncAccessCB::process()
+{
+  // rcode_ is the error of the rpc framework on the runner, the error of
+  // the task itself is carried by the response
+  finish(rcode_.rcode_);
+  return OB_SUCCESS;
+}
+
+void ObDASAsyncAccessCB::on_invalid()
+{
+  int ret = OB_RPC_PACKET_INVALID;
+  LOG_WARN("das async access response is invalid", K(ret), K(task_op_));
+  finish(ret);
+}
+
+void ObDASAsyncAccessCB::on_timeout()
+{
+  int ret = OB_TIMEOUT;
+  LOG_WARN("das async access timeout", K(ret), K(task_op_));
+  finish(ret);
+}
+
+int ObDASAsyncAccessCB::on_error(int err)
+{
+  int ret = OB_RPC_SEND_ERROR;
+  LOG_WARN("das async access failed", K(ret), K(err), K(task_op_));
+  finish(ret);
+  return OB_SUCCESS;
+}
+
+void ObDASAsyncAccessCB::finish(const int rpc_ret)
+{
+  ObThreadCondGuard guard(cond_);
+  rpc_ret_ = rpc_ret;
+  is_done_ = true;
+  (void)cond_.broadcast();
+}
+
+rpc::frame::ObReqTransport::AsyncCB *ObDASAsyncAccessCB::clone(const rpc::frame::SPAlloc &alloc) const
+{
+  // the callback lives in the das allocator until the controller has seen
+  // it finished, no copy is needed
+  UNUSED(alloc);
+  return const_cast<rpc::frame::ObReqTransport::AsyncCB *>(
+      static_cast<const rpc::frame::ObReqTransport::AsyncCB *const>(this));
+}
 }  // namespace sql
 }  // namespace oceanbase
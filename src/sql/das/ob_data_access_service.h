@@ -16,6 +16,7 @@
 #include "sql/das/ob_das_rpc_proxy.h"
 #include "sql/das/ob_das_id_cache.h"
 #include "sql/das/ob_das_task_result.h"
+#include "lib/lock/ob_thread_cond.h"
 namespace oceanbase
 {
 namespace sql
@@ -25,6 +26,41 @@ class ObDASTaskArg;
 class ObDASTaskResp;
 class ObPhyTableLocation;
 class ObDASExtraData;
+
+// Callback of an async das access rpc. It is owned by the controller thread,
+// which waits on cond_ until the rpc framework reports the response,
+// timeout or error of every callback it sent.
+class ObDASAsyncAccessCB : public obrpc::ObDASRpcProxy::AsyncCB<obrpc::OB_DAS_ASYNC_ACCESS>
+{
+public:
+  ObDASAsyncAccessCB(common::ObThreadCond &cond, ObIDASTaskOp &task_op)
+    : cond_(cond),
+      task_op_(task_op),
+      is_done_(false),
+      rpc_ret_(common::OB_SUCCESS)
+  { }
+  virtual ~ObDASAsyncAccessCB() { }
+  virtual int process() override;
+  virtual void on_invalid() override;
+  virtual void on_timeout() override;
+  virtual int on_error(int err) override;
+  virtual rpc::frame::ObReqTransport::AsyncCB *clone(const rpc::frame::SPAlloc &alloc) const override;
+  virtual void set_args(const Request &arg) override { UNUSED(arg); }
+  // mark the rpc as finished and wake up the controller
+  void finish(const int rpc_ret);
+  ObDASTaskResp &get_task_resp() { return result_; }
+  ObIDASTaskOp &get_task_op() { return task_op_; }
+  // must be called with cond_ locked
+  bool is_done() const { return is_done_; }
+  int get_rpc_ret() const { return rpc_ret_; }
+  TO_STRING_KV(K_(is_done), K_(rpc_ret), K_(rcode));
+private:
+  common::ObThreadCond &cond_;
+  ObIDASTaskOp &task_op_;
+  bool is_done_;
+  int rpc_ret_;
+};
+
 class ObDataAccessService
 {
 public:
@@ -39,6 +75,8 @@ public:
            const common::ObAddr &self_addr);
   //开启DAS Task分区相关的事务控制，并执行task对应的op
   int execute_das_task(ObDASRef &das_ref, ObIDASTaskOp &task_op);
+  //执行das_ref中所有的task，不同server上的task通过异步RPC同时发送，本地task在等待期间执行
+  int parallel_execute_das_task(ObDASRef &das_ref);
   //关闭DAS Task的执行流程，并释放task持有的资源，并结束相关的事务控制
   int end_das_task(ObDASRef &das_ref, ObIDASTaskOp &task_op);
   int get_das_task_id(int64_t &das_id);
@@ -53,6 +91,33 @@ private:
   int retry_das_task(ObDASRef &das_ref, ObIDASTaskOp &task_op);
   int do_local_das_task(ObDASRef &das_ref, ObDASTaskArg &task_arg);
   int do_remote_das_task(ObDASRef &das_ref, ObDASTaskArg &das_task);
+  int process_das_task_ret(ObDASRef &das_ref, ObIDASTaskOp &task_op);
+  int process_remote_task_resp(ObDASRef &das_ref,
+                               ObIDASTaskOp &task_op,
+                               ObIDASTaskResult &op_result,
+                               ObDASTaskResp &task_resp);
+  // split pending tasks into the ones run on this thread (local tasks, and
+  // tasks of servers without the async rpc), at most one async task per
+  // remote server, and the ones left for the next wave
+  static int split_das_task_wave(const common::ObAddr &ctrl_addr,
+                                 const common::ObIArray<common::ObAddr> &sync_svrs,
+                                 const common::ObIArray<ObIDASTaskOp*> &pending_tasks,
+                                 common::ObIArray<ObIDASTaskOp*> &sync_tasks,
+                                 common::ObIArray<ObIDASTaskOp*> &async_tasks,
+                                 common::ObIArray<ObIDASTaskOp*> &next_tasks);
+  int send_async_das_task(ObDASRef &das_ref,
+                          ObIDASTaskOp &task_op,
+                          ObDASAsyncAccessCB &cb);
+  static void wait_async_das_task(common::ObThreadCond &cond,
+                                  const common::ObIArray<ObDASAsyncAccessCB*> &cbs);
+  int process_async_das_resp(ObDASRef &das_ref, ObDASAsyncAccessCB &cb);
+  // process and destroy the callbacks of a wave, once last_ret or a response
+  // failed only the transaction participants of the rest are collected
+  int process_async_das_resps(ObDASRef &das_ref,
+                              const common::ObIArray<ObDASAsyncAccessCB*> &cbs,
+                              common::ObIArray<common::ObAddr> &sync_svrs,
+                              const int last_ret);
+  void merge_async_das_trans_result(ObDASRef &das_ref, ObDASAsyncAccessCB &cb);
   int setup_extra_result(ObDASRef &das_ref,
                          ObDASTaskResp &task_resp,
                          ObIDASTaskOp *task_op,
@@ -16,6 +16,7 @@
 #include "sql/engine/ob_exec_context.h"
 #include "sql/resolver/expr/ob_raw_expr_util.h"
 #include "sql/code_generator/ob_static_engine_cg.h"
+#include "sql/engine/expr/ob_expr_join_filter.h"
 #include "storage/blocksstable/encoding/ob_encoding_query_util.h"
 #include "storage/blocksstable/ob_datum_row.h"
 
@@ -1314,6 +1315,21 @@ int ObBlackFilterExecutor::filter_batch(
             K(result_bitmap.popcnt()));
   return ret;
 }
+bool ObBlackFilterExecutor::is_pass_through(const int64_t row_count)
+{
+  bool pass_through = filter_.filter_exprs_.count() > 0;
+  ObEvalCtx &eval_ctx = op_.get_eval_ctx();
+  for (int64_t i = 0; pass_through && i < filter_.filter_exprs_.count(); i++) {
+    const ObExpr *e = filter_.filter_exprs_.at(i);
+    pass_through = nullptr != e
+        && T_OP_JOIN_BLOOM_FILTER == e->type_
+        && ObExprJoinFilter::is_pass_through(*e, eval_ctx);
+  }
+  for (int64_t i = 0; pass_through && i < filter_.filter_exprs_.count(); i++) {
+    ObExprJoinFilter::add_pass_through_rows(*filter_.filter_exprs_.at(i), eval_ctx, row_count);
+  }
+  return pass_through;
+}
 //--------------------- end filter executor ----------------------------
 
 
@@ -409,6 +409,9 @@ public:
                    const int64_t end,
                    common::ObBitmap &result_bitmap);
   int get_datums_from_column(common::ObIArray<common::ObDatum *> &datums);
+  // true if all filter exprs are runtime join filters which are not ready yet,
+  // the row_count rows of the micro block are then counted as passed by them
+  bool is_pass_through(const int64_t row_count);
   INHERIT_TO_STRING_KV("ObPushdownBlackFilterExecutor", ObPushdownFilterExecutor,
                        K_(filter), K_(n_eval_infos),
                        KP_(eval_infos), KP_(skip_bit));
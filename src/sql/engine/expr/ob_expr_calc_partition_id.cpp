@@ -135,6 +135,7 @@ int ObExprCalcPartitionBase::cg_expr(ObExprCGCtx &expr_cg_ctx,
     } else if (1 == param_cnt) {
       OB_ASSERT(PARTITION_LEVEL_ONE == calc_part_info->part_level_);
       rt_expr.eval_func_ = ObExprCalcPartitionBase::calc_partition_level_one;
+      rt_expr.eval_batch_func_ = ObExprCalcPartitionBase::calc_partition_level_one_batch;
     } else if (2 == param_cnt) {
       OB_ASSERT(PARTITION_LEVEL_TWO == calc_part_info->part_level_);
       rt_expr.eval_func_ = ObExprCalcPartitionBase::calc_partition_level_two;
@@ -250,6 +251,93 @@ int ObExprCalcPartitionBase::calc_partition_level_one(const ObExpr &expr,
   return ret;
 }
 
+// Bulk binds and px repartition evaluate a batch of keys of one table, the tablet mapper is
+// fetched once for the batch, and consecutive equal keys reuse the previous location.
+int ObExprCalcPartitionBase::calc_partition_level_one_batch(const ObExpr &expr,
+                                                            ObEvalCtx &ctx,
+                                                            const ObBitVector &skip,
+                                                            const int64_t batch_size)
+{
+  int ret = OB_SUCCESS;
+  OB_ASSERT(1 == expr.arg_cnt_);
+  CalcPartitionBaseInfo *calc_part_info = reinterpret_cast<CalcPartitionBaseInfo *>(expr.extra_info_);
+  const ObExpr &part_expr = *expr.args_[0];
+  ObDatum *results = expr.locate_batch_datums(ctx);
+  ObBitVector &eval_flags = expr.get_evaluated_flags(ctx);
+  ObEvalCtx::BatchInfoScopeGuard batch_info_guard(ctx);
+  batch_info_guard.set_batch_size(batch_size);
+  if (OB_ISNULL(calc_part_info)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("calc part info is null", K(ret));
+  } else if (T_OP_ROW == part_expr.type_) {
+    for (int64_t i = 0; OB_SUCC(ret) && i < batch_size; ++i) {
+      if (skip.at(i) || eval_flags.at(i)) {
+        continue;
+      }
+      batch_info_guard.set_batch_idx(i);
+      if (OB_FAIL(calc_partition_level_one(expr, ctx, results[i]))) {
+        LOG_WARN("fail to calc partition id", K(ret), K(i));
+      } else {
+        eval_flags.set(i);
+      }
+    }
+  } else if (OB_FAIL(part_expr.eval_batch(ctx, skip, batch_size))) {
+    LOG_WARN("part expr evaluate failed", K(ret));
+  } else {
+    ObDatumVector part_datums = part_expr.locate_expr_datumvector(ctx);
+    ObDASTabletMapper tablet_mapper;
+    const ObDatum *last_datum = NULL;
+    ObTabletID tablet_id(ObTabletID::INVALID_TABLET_ID);
+    ObObjectID partition_id = OB_INVALID_ID;
+    ObObj func_value;
+    if (OB_FAIL(ctx.exec_ctx_.get_das_ctx().get_das_tablet_mapper(calc_part_info->ref_table_id_,
+                                                                  tablet_mapper,
+                                                                  &calc_part_info->related_table_ids_))) {
+      LOG_WARN("get das tablet mapper failed", K(ret), KPC(calc_part_info));
+    }
+    for (int64_t i = 0; OB_SUCC(ret) && i < batch_size; ++i) {
+      if (skip.at(i) || eval_flags.at(i)) {
+        continue;
+      }
+      batch_info_guard.set_batch_idx(i);
+      const ObDatum *datum = part_datums.at(i);
+      if (NULL != last_datum && ObDatum::binary_equal(*last_datum, *datum)) {
+        // same key as the previous row, so is the location
+      } else if (OB_FAIL(datum->to_obj(func_value,
+                                       part_expr.obj_meta_,
+                                       part_expr.obj_datum_map_))) {
+        LOG_WARN("convert datum to obj failed", K(ret));
+      } else if (OB_FAIL(calc_partition_id_by_value(ctx,
+                                                    tablet_mapper,
+                                                    *calc_part_info,
+                                                    PARTITION_LEVEL_ONE,
+                                                    calc_part_info->part_type_,
+                                                    OB_INVALID_ID, /*first_part_id*/
+                                                    func_value,
+                                                    tablet_id,
+                                                    partition_id))) {
+        LOG_WARN("fail to calc partition id by value", K(ret), K(part_expr));
+      } else {
+        last_datum = datum;
+      }
+      if (OB_FAIL(ret)) {
+      } else if (CALC_TABLET_ID == calc_part_info->calc_id_type_) {
+        results[i].set_int(tablet_id.id());
+      } else if (CALC_PARTITION_ID == calc_part_info->calc_id_type_) {
+        results[i].set_int(partition_id);
+      } else if (CALC_PARTITION_TABLET_ID == calc_part_info->calc_id_type_) {
+        if (OB_FAIL(concat_part_and_tablet_id(expr, ctx, results[i], partition_id, tablet_id.id()))) {
+          LOG_WARN("fail to concat partition id and tablet id", K(ret));
+        }
+      }
+      if (OB_SUCC(ret)) {
+        eval_flags.set(i);
+      }
+    }
+  }
+  return ret;
+}
+
 int ObExprCalcPartitionBase::calc_partition_level_two(const ObExpr &expr,
                                                       ObEvalCtx &ctx,
                                                       ObDatum &res_datum)
@@ -517,7 +605,6 @@ int ObExprCalcPartitionBase::calc_partition_id(const ObExpr &part_expr,
     }
   } else { // not list/range columns
     ObObj func_value;
-    ObObj result;
     ObDatum *datum = NULL;
     if (OB_FAIL(part_expr.eval(ctx, datum))) {
       LOG_WARN("part expr evaluate failed", K(ret));
@@ -525,57 +612,82 @@ int ObExprCalcPartitionBase::calc_partition_id(const ObExpr &part_expr,
                                      part_expr.obj_meta_,
                                      part_expr.obj_datum_map_))) {
       LOG_WARN("convert datum to obj failed", K(ret));
+    } else if (OB_FAIL(calc_partition_id_by_value(ctx,
+                                                  tablet_mapper,
+                                                  calc_part_info,
+                                                  part_level,
+                                                  part_type,
+                                                  first_part_id,
+                                                  func_value,
+                                                  tablet_id,
+                                                  partition_id))) {
+      LOG_WARN("fail to calc partition id by value", K(ret), K(part_expr));
+    }
+  }
+
+  return ret;
+}
+
+int ObExprCalcPartitionBase::calc_partition_id_by_value(ObEvalCtx &ctx,
+                                                        ObDASTabletMapper &tablet_mapper,
+                                                        const CalcPartitionBaseInfo &calc_part_info,
+                                                        const ObPartitionLevel part_level,
+                                                        const ObPartitionFuncType part_type,
+                                                        const ObObjectID first_part_id,
+                                                        const ObObj &func_value,
+                                                        ObTabletID &tablet_id,
+                                                        ObObjectID &partition_id)
+{
+  int ret = OB_SUCCESS;
+  ObObj result = func_value;
+  tablet_id.reset();
+  partition_id = OB_INVALID_ID;
+  if (PARTITION_FUNC_TYPE_HASH == part_type) {
+    if (lib::is_oracle_mode()) {
+      // do nothing
+    } else if (OB_FAIL(ObExprFuncPartHash::calc_value_for_mysql(func_value, result,
+                func_value.get_type()))) {
+      LOG_WARN("Failed to calc hash value mysql mode", K(ret));
+    }
+  }
+  if (OB_SUCC(ret)) {
+    ObSEArray<ObTabletID, 1> tablet_ids;
+    ObSEArray<ObObjectID, 1> partition_ids;
+    //这里也可以统一使用上面的ObNewRow接口, 并把calc_value_for_mysql
+    // 用datum实现下,  暂时和以前的方式保持一致
+    ObRowkey rowkey(const_cast<ObObj*>(&result), 1);
+    ObNewRange range;
+    if (OB_FAIL(range.build_range(calc_part_info.ref_table_id_, rowkey))) {
+      LOG_WARN("Failed to build range", K(ret));
+    } else if (OB_FAIL(tablet_mapper.get_tablet_and_object_id(
+                                      part_level,
+                                      first_part_id,
+                                      range,
+                                      tablet_ids,
+                                      partition_ids))) {
+      LOG_WARN("Failed to get part id", K(ret));
+    } else if (partition_ids.count() != 0 && partition_ids.count() != 1) {
+      ret = OB_INVALID_ARGUMENT;
+      LOG_WARN("invalid partition cnt", K(ret), K(partition_ids), K(range), K(rowkey));
     } else {
-      result = func_value;
-      if (PARTITION_FUNC_TYPE_HASH == part_type) {
-        if (lib::is_oracle_mode()) {
-          // do nothing
-        } else if (OB_FAIL(ObExprFuncPartHash::calc_value_for_mysql(func_value, result,
-                    func_value.get_type()))) {
-          LOG_WARN("Failed to calc hash value mysql mode", K(ret));
-        }
+      if (0 == partition_ids.count() &&
+         PARTITION_LEVEL_ONE == part_level &&
+         NULL != ctx.exec_ctx_.get_my_session() &&
+         ORACLE_MODE == ctx.exec_ctx_.get_my_session()->get_compatibility_mode()) {
+        ObEvalCtx::TempAllocGuard alloc_guard(ctx);
+        ObIAllocator &allocator = alloc_guard.get_allocator();
+        ObNewRow row(const_cast<ObObj*>(&result), 1);
+        OZ (add_interval_part(ctx.exec_ctx_, calc_part_info, allocator, row),
+                                       calc_part_info, first_part_id);
       }
-      if (OB_SUCC(ret)) {
-        ObSEArray<ObTabletID, 1> tablet_ids;
-        ObSEArray<ObObjectID, 1> partition_ids;
-        //这里也可以统一使用上面的ObNewRow接口, 并把calc_value_for_mysql
-        // 用datum实现下,  暂时和以前的方式保持一致
-        ObRowkey rowkey(const_cast<ObObj*>(&result), 1);
-        ObNewRange range;
-        if (OB_FAIL(range.build_range(calc_part_info.ref_table_id_, rowkey))) {
-          LOG_WARN("Failed to build range", K(ret));
-        } else if (OB_FAIL(tablet_mapper.get_tablet_and_object_id(
-                                          part_level,
-                                          first_part_id,
-                                          range,
-                                          tablet_ids,
-                                          partition_ids))) {
-          LOG_WARN("Failed to get part id", K(ret));
-        } else if (partition_ids.count() != 0 && partition_ids.count() != 1) {
-          ret = OB_INVALID_ARGUMENT;
-          LOG_WARN("invalid partition cnt", K(ret), K(part_expr), K(partition_ids), K(range), K(rowkey));
-        } else {
-          if (0 == partition_ids.count() &&
-             PARTITION_LEVEL_ONE == part_level &&
-             NULL != ctx.exec_ctx_.get_my_session() &&
-             ORACLE_MODE == ctx.exec_ctx_.get_my_session()->get_compatibility_mode()) {
-            ObEvalCtx::TempAllocGuard alloc_guard(ctx);
-            ObIAllocator &allocator = alloc_guard.get_allocator();
-            ObNewRow row(const_cast<ObObj*>(&result), 1);
-            OZ (add_interval_part(ctx.exec_ctx_, calc_part_info, allocator, row),
-                                           calc_part_info, first_part_id);
-          }
-          if (OB_SUCC(ret) && 1 == partition_ids.count()) {
-            partition_id = partition_ids.at(0);
-            if (1 == tablet_ids.count()) {
-              tablet_id = tablet_ids.at(0);
-            }
-          }
+      if (OB_SUCC(ret) && 1 == partition_ids.count()) {
+        partition_id = partition_ids.at(0);
+        if (1 == tablet_ids.count()) {
+          tablet_id = tablet_ids.at(0);
         }
       }
     }
   }
-
   return ret;
 }
 
@@ -30,6 +30,7 @@ namespace schema
 namespace sql
 {
 class ObExprResType;
+class ObDASTabletMapper;
 typedef common::ObFixedArray<common::ObTableID, common::ObIAllocator> TableIDFixedArray;
 //calc partition base info
 enum CalcPartIdType {
@@ -114,6 +115,10 @@ public:
   static int calc_partition_level_one(const ObExpr &expr,
                                       ObEvalCtx &ctx,
                                       ObDatum &res_datum);
+  static int calc_partition_level_one_batch(const ObExpr &expr,
+                                            ObEvalCtx &ctx,
+                                            const ObBitVector &skip,
+                                            const int64_t batch_size);
   static int calc_partition_level_two(const ObExpr &expr,
                                       ObEvalCtx &ctx,
                                       ObDatum &res_datum);
@@ -145,6 +150,15 @@ private:
                                common::ObObjectID first_part_id,
                                common::ObTabletID &tablet_id,
                                common::ObObjectID &partition_id);
+  static int calc_partition_id_by_value(ObEvalCtx &ctx,
+                                        ObDASTabletMapper &tablet_mapper,
+                                        const CalcPartitionBaseInfo &calc_part_info,
+                                        const share::schema::ObPartitionLevel part_level,
+                                        const share::schema::ObPartitionFuncType part_type,
+                                        const common::ObObjectID first_part_id,
+                                        const common::ObObj &func_value,
+                                        common::ObTabletID &tablet_id,
+                                        common::ObObjectID &partition_id);
   static int add_interval_part(ObExecContext &exec_ctx,
                 const CalcPartitionBaseInfo &calc_part_info,
                 ObIAllocator &allocator, ObNewRow &row);
@@ -31,6 +31,7 @@ void ObExprJoinFilter::ObExprJoinFilterContext::reset_monitor_info()
   total_count_ = 0;
   check_count_ = 0;
   n_times_ = 0;
+  n_pass_through_ = 0;
   ready_ts_ = 0;
   is_ready_ = false;
 }
@@ -262,6 +263,40 @@ int ObExprJoinFilter::eval_bloom_filter_batch(
   return ret;
 }
 
+bool ObExprJoinFilter::is_pass_through(const ObExpr &expr, ObEvalCtx &ctx)
+{
+  bool pass_through = true;
+  ObExprJoinFilterContext *join_filter_ctx = NULL;
+  if (OB_ISNULL(join_filter_ctx = static_cast<ObExprJoinFilterContext *>(
+            ctx.exec_ctx_.get_expr_op_ctx(expr.expr_ctx_id_)))) {
+    // join filter ctx may be null in das, every row matches.
+  } else if (join_filter_ctx->is_ready_ || join_filter_ctx->wait_ready_) {
+    pass_through = false;
+  } else {
+    ObPxBloomFilter *&bloom_filter_ptr_ = join_filter_ctx->bloom_filter_ptr_;
+    if (OB_ISNULL(bloom_filter_ptr_) && (join_filter_ctx->n_pass_through_++ & CHECK_TIMES) == 0) {
+      (void)ObPxBloomFilterManager::instance().get_px_bloom_filter(join_filter_ctx->bf_key_,
+                                                                   bloom_filter_ptr_);
+    }
+    if (OB_NOT_NULL(bloom_filter_ptr_) && bloom_filter_ptr_->check_ready()) {
+      join_filter_ctx->ready_ts_ = ObTimeUtility::current_time();
+      join_filter_ctx->is_ready_ = true;
+      pass_through = false;
+    }
+  }
+  return pass_through;
+}
+
+void ObExprJoinFilter::add_pass_through_rows(const ObExpr &expr, ObEvalCtx &ctx, const int64_t row_cnt)
+{
+  ObExprJoinFilterContext *join_filter_ctx = NULL;
+  if (OB_NOT_NULL(join_filter_ctx = static_cast<ObExprJoinFilterContext *>(
+            ctx.exec_ctx_.get_expr_op_ctx(expr.expr_ctx_id_)))) {
+    join_filter_ctx->n_times_ += row_cnt;
+    join_filter_ctx->total_count_ += row_cnt;
+  }
+}
+
 int ObExprJoinFilter::cg_expr(ObExprCGCtx &expr_cg_ctx, const ObRawExpr &raw_expr,
                       ObExpr &rt_expr) const
 {
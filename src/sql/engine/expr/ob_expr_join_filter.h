@@ -26,7 +26,7 @@ public:
     public:
       ObExprJoinFilterContext() : ObExprOperatorCtx(), 
           bloom_filter_ptr_(NULL), bf_key_(), filter_count_(0), total_count_(0), check_count_(0),
-          n_times_(0), ready_ts_(0), is_ready_(false), wait_ready_(false) {}
+          n_times_(0), n_pass_through_(0), ready_ts_(0), is_ready_(false), wait_ready_(false) {}
       virtual ~ObExprJoinFilterContext() {} 
       void reset_monitor_info();
       ObPxBloomFilter *bloom_filter_ptr_;
@@ -35,6 +35,7 @@ public:
       int64_t total_count_;
       int64_t check_count_;
       int64_t n_times_;
+      int64_t n_pass_through_;
       int64_t ready_ts_;
       bool is_ready_;
       bool wait_ready_;
@@ -50,6 +51,11 @@ public:
   static int eval_bloom_filter(const ObExpr &expr, ObEvalCtx &ctx, ObDatum &res);
   static int eval_bloom_filter_batch(
              const ObExpr &expr, ObEvalCtx &ctx, const ObBitVector &skip, const int64_t batch_size);
+  // A join filter which is not ready yet lets every row pass, storage checks it
+  // once per micro block to avoid decoding columns for nothing.
+  static bool is_pass_through(const ObExpr &expr, ObEvalCtx &ctx);
+  // count the rows let pass by storage without evaluating the filter
+  static void add_pass_through_rows(const ObExpr &expr, ObEvalCtx &ctx, const int64_t row_cnt);
   virtual int cg_expr(ObExprCGCtx &expr_cg_ctx, const ObRawExpr &raw_expr,
                       ObExpr &rt_expr) const override;
   virtual bool need_rt_ctx() const override { return true; }
@@ -864,11 +864,53 @@ int ObOperator::close()
       ret = tmp_ret; // overwrite child's error code.
       LOG_WARN("Close this operator failed", K(ret), "op_type", op_name());
     }
+    if (OB_SUCC(ret)) {
+      feedback_card_misestimate();
+    }
     IGNORE_RETURN submit_op_monitor_node();
   }
   return ret;
 }
 
+// The input of a materialization point is fully consumed before the operator produces
+// rows, its actual row count is compared with the estimate of the child.
+bool ObOperator::get_card_feedback(uint64_t &op_id,
+                                   int64_t &est_rows,
+                                   int64_t &output_rows,
+                                   int64_t &scan_times) const
+{
+  bool bret = false;
+  if (child_cnt_ > 0
+      && (PHY_SORT == spec_.type_
+          || PHY_MATERIAL == spec_.type_
+          || PHY_HASH_JOIN == spec_.type_
+          || PHY_TEMP_TABLE_INSERT == spec_.type_)) {
+    const ObOperator *child = children_[0];
+    op_id = child->spec_.id_;
+    est_rows = child->spec_.rows_;
+    // output rows of the child accumulate over rescans, e.g. under a nested loop join
+    output_rows = child->op_monitor_info_.output_row_count_;
+    scan_times = child->op_monitor_info_.rescan_times_ + 1;
+    bret = true;
+  }
+  return bret;
+}
+
+void ObOperator::feedback_card_misestimate()
+{
+  uint64_t op_id = OB_INVALID_ID;
+  int64_t est_rows = 0;
+  int64_t output_rows = 0;
+  int64_t scan_times = 0;
+  // a px worker only sees its share of the rows, the qc decides for the whole dfo
+  if (OB_NOT_NULL(spec_.plan_)
+      && OB_ISNULL(ctx_.get_sqc_handler())
+      && GCONF._enable_cardinality_feedback
+      && get_card_feedback(op_id, est_rows, output_rows, scan_times)) {
+    spec_.plan_->check_card_misestimate(op_id, est_rows, output_rows, scan_times);
+  }
+}
+
 int ObOperator::submit_op_monitor_node()
 {
   int ret = OB_SUCCESS;
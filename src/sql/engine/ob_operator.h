@@ -488,6 +488,11 @@ public:
   ObOperator *get_child(int32_t child_idx) { return children_[child_idx]; }
   bool is_opened() { return opened_; }
   ObMonitorNode &get_monitor_info() { return op_monitor_info_; }
+  // rows of the input of a materialization point over all scans and their estimation
+  bool get_card_feedback(uint64_t &op_id,
+                         int64_t &est_rows,
+                         int64_t &output_rows,
+                         int64_t &scan_times) const;
   bool is_vectorized() const { return spec_.is_vectorized(); }
   int init_evaluated_flags();
   static int filter_row(ObEvalCtx &eval_ctx,
@@ -559,6 +564,7 @@ private:
   // for sql plan monitor
   int try_register_rt_monitor_node(int64_t rows);
   int try_deregister_rt_monitor_node();
+  void feedback_card_misestimate();
   int submit_op_monitor_node();
   bool match_rt_monitor_condition(int64_t rows);
   int check_stack_once();
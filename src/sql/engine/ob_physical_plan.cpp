@@ -615,6 +615,32 @@ bool ObPhysicalPlan::is_plan_unstable(const int64_t sample_count,
   return bret;
 }
 
+/**
+ * 物化点（sort、material、hash join build、temp table）实际行数远超估算行数时，
+ * 说明代价模型基于的基数已经失真，淘汰计划使下次执行重新优化。
+ * 为避免统计信息未变化时反复硬解析，计划生成后至少服务 CARD_FEEDBACK_MIN_PLAN_AGE 才会因此淘汰。
+ */
+void ObPhysicalPlan::check_card_misestimate(const int64_t op_id,
+                                            const int64_t est_rows,
+                                            const int64_t output_rows,
+                                            const int64_t scan_times)
+{
+  // 嵌套循环连接右表等被重复扫描的算子，按单次扫描的行数比较
+  const int64_t actual_rows = output_rows / std::max(scan_times, 1L);
+  if (is_expired()) {
+    // do nothing
+  } else if (actual_rows <= CARD_MISESTIMATE_ROW_THRESHOLD
+             || actual_rows / std::max(est_rows, 1L) < CARD_MISESTIMATE_RATIO) {
+    // estimation is acceptable
+  } else if (ObTimeUtility::current_time() - stat_.gen_time_ < CARD_FEEDBACK_MIN_PLAN_AGE) {
+    // plan is just generated
+  } else {
+    set_is_expired(true);
+    LOG_INFO("plan is expired due to cardinality misestimate", K(op_id), K(est_rows),
+             K(actual_rows), K(scan_times), "sql_id", get_sql_id(), "plan_id", get_plan_id());
+  }
+}
+
 int64_t ObPhysicalPlan::get_evo_perf() const {
   int64_t v = 0;
   if (0 == stat_.evolution_stat_.executions_) {
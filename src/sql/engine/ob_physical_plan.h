@@ -94,6 +94,9 @@ public:
   static const int64_t SLOW_QUERY_SAMPLE_SIZE = 20; // smaller than ObPlanStat::MAX_SCAN_STAT_SIZE
   static const int64_t TABLE_ROW_CHANGE_THRESHOLD = 2;
   static const int64_t EXPIRED_PLAN_TABLE_ROW_THRESHOLD = 100;
+  static const int64_t CARD_MISESTIMATE_ROW_THRESHOLD = 100000;
+  static const int64_t CARD_MISESTIMATE_RATIO = 100;
+  static const int64_t CARD_FEEDBACK_MIN_PLAN_AGE = 60 * 1000 * 1000L; // 60s
   OB_UNIS_VERSION(1);
 public:
   explicit ObPhysicalPlan(lib::MemoryContext &mem_context = CURRENT_CONTEXT);
@@ -147,6 +150,11 @@ public:
                         const int64_t sample_exec_usec);
   bool is_expired() const { return stat_.is_expired_; }
   void set_is_expired(bool expired) { stat_.is_expired_ = expired; }
+  // expire the plan if an operator materialized far more rows per scan than estimated
+  void check_card_misestimate(const int64_t op_id,
+                              const int64_t est_rows,
+                              const int64_t output_rows,
+                              const int64_t scan_times);
   void inc_large_querys();
   void inc_delayed_large_querys();
   void inc_delayed_px_querys();
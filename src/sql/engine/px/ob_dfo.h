@@ -376,7 +376,8 @@ public:
     use_filter_ch_map_(),
     total_task_cnt_(0),
     ignore_vtable_error_(false),
-    pkey_table_loc_id_(0)
+    pkey_table_loc_id_(0),
+    card_feedback_info_()
   {
   }
 
@@ -407,6 +408,7 @@ public:
   inline void set_phy_plan(const ObPhysicalPlan *phy_plan) { phy_plan_ = phy_plan; }
   inline const ObPhysicalPlan *get_phy_plan() const { return phy_plan_; }
   inline void set_root_op_spec(const ObOpSpec *op_spec) {root_op_spec_ = op_spec;}
+  ObPxCardFeedbackInfo &get_card_feedback_info() { return card_feedback_info_; }
   inline const ObOpSpec *get_root_op_spec() { return root_op_spec_; }
   inline void get_root(const ObOpSpec *&root) const { root = root_op_spec_; }
   inline void set_scan(bool has_scan) { has_scan_ = has_scan; }
@@ -636,6 +638,7 @@ private:
   int64_t total_task_cnt_;      // the task total count of dfo start worker
   bool ignore_vtable_error_;
   int64_t pkey_table_loc_id_; // record pkey table loc id for child dfo
+  ObPxCardFeedbackInfo card_feedback_info_; // 所有 sqc 物化点的实际行数之和
 };
 
 
@@ -729,7 +732,8 @@ public:
       temp_table_id_(common::OB_INVALID_ID),
       interm_result_ids_(),
       tx_desc_(NULL),
-      is_use_local_thread_(false)
+      is_use_local_thread_(false),
+      card_feedback_info_()
   {}
   ~ObPxTask() = default;
   ObPxTask &operator=(const ObPxTask &other)
@@ -755,6 +759,7 @@ public:
     interm_result_ids_.assign(other.interm_result_ids_);
     tx_desc_ = other.tx_desc_;
     is_use_local_thread_ = other.is_use_local_thread_;
+    card_feedback_info_.assign(other.card_feedback_info_);
     return *this;
   }
 public:
@@ -844,6 +849,7 @@ public:
   common::ObSEArray<uint64_t, 8> interm_result_ids_;  //返回每个task生成的结果集
   transaction::ObTxDesc *tx_desc_; // transcation information
   bool is_use_local_thread_;
+  ObPxCardFeedbackInfo card_feedback_info_; // task 中物化点的实际行数
 };
 
 class ObPxRpcInitTaskArgs
@@ -166,6 +166,8 @@ ObGranuleIteratorOp::ObGranuleIteratorOp(ObExecContext &exec_ctx, const ObOpSpec
   pwj_rescan_task_infos_(),
   filter_count_(0),
   total_count_(0),
+  busy_start_ts_(0),
+  busy_time_(0),
   bf_key_(),
   bloom_filter_ptr_(NULL),
   tablet2part_id_map_(),
@@ -173,6 +175,8 @@ ObGranuleIteratorOp::ObGranuleIteratorOp(ObExecContext &exec_ctx, const ObOpSpec
 {
   op_monitor_info_.otherstat_1_id_ = ObSqlMonitorStatIds::FILTERED_GRANULE_COUNT;
   op_monitor_info_.otherstat_2_id_ = ObSqlMonitorStatIds::TOTAL_GRANULE_COUNT;
+  op_monitor_info_.otherstat_3_id_ = ObSqlMonitorStatIds::GRANULE_BUSY_TIME;
+  op_monitor_info_.otherstat_4_id_ = ObSqlMonitorStatIds::GRANULE_END_TIMESTAMP;
 }
 
 void ObGranuleIteratorOp::destroy()
@@ -519,10 +523,19 @@ int ObGranuleIteratorOp::get_next_granule_task(bool prepare /* = false */)
 {
   int ret = OB_SUCCESS;
   bool partition_pruning = true;
+  if (0 == busy_start_ts_) {
+    busy_start_ts_ = ObTimeUtility::current_time();
+  }
   while (OB_SUCC(ret) && partition_pruning) {
     if (OB_FAIL(do_get_next_granule_task(partition_pruning))) {
       if (ret != OB_ITER_END) {
         LOG_WARN("failed to get all granule task", K(ret));
+      } else {
+        const int64_t end_ts = ObTimeUtility::current_time();
+        busy_time_ += end_ts - busy_start_ts_;
+        busy_start_ts_ = 0;
+        op_monitor_info_.otherstat_3_value_ = busy_time_;
+        op_monitor_info_.otherstat_4_value_ = end_ts;
       }
     }
   }
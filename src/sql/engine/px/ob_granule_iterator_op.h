@@ -223,6 +223,10 @@ private:
    //for partition pruning
   int64_t filter_count_; // filtered part count when part pruning activated
   int64_t total_count_; // total partition count or block count processed, rescan included
+  // worker busy time on granules, the gap between the granule end time of
+  // workers of a dfo is their idle time
+  int64_t busy_start_ts_;
+  int64_t busy_time_;
   ObPXBloomFilterHashWrapper bf_key_;
   ObPxBloomFilter *bloom_filter_ptr_;
   ObPxTablet2PartIdMap tablet2part_id_map_;
@@ -29,7 +29,7 @@ OB_SERIALIZE_MEMBER(ObPxPartChMapItem, first_, second_, third_);
 OB_SERIALIZE_MEMBER(ObPxReceiveDataChannelMsg, child_dfo_id_, ch_sets_, ch_total_info_, has_filled_channel_);
 OB_SERIALIZE_MEMBER(ObPxTransmitDataChannelMsg, ch_sets_, part_affinity_map_, ch_total_info_, has_filled_channel_);
 OB_SERIALIZE_MEMBER(ObPxInitSqcResultMsg, dfo_id_, sqc_id_, rc_, task_count_);
-OB_SERIALIZE_MEMBER(ObPxFinishSqcResultMsg, dfo_id_, sqc_id_, rc_, trans_result_, task_monitor_info_array_, sqc_affected_rows_, dml_row_info_, temp_table_id_, interm_result_ids_);
+OB_SERIALIZE_MEMBER(ObPxFinishSqcResultMsg, dfo_id_, sqc_id_, rc_, trans_result_, task_monitor_info_array_, sqc_affected_rows_, dml_row_info_, temp_table_id_, interm_result_ids_, card_feedback_info_);
 OB_SERIALIZE_MEMBER(ObPxFinishTaskResultMsg, dfo_id_, sqc_id_, task_id_, rc_);
 OB_SERIALIZE_MEMBER((ObPxBloomFilterChInfo, dtl::ObDtlChTotalInfo), filter_id_);
 OB_SERIALIZE_MEMBER((ObPxBloomFilterChSet, dtl::ObDtlChSet), filter_id_, sqc_id_);
@@ -37,6 +37,8 @@ OB_SERIALIZE_MEMBER(ObPxCreateBloomFilterChannelMsg, sqc_count_, sqc_id_, ch_set
 OB_SERIALIZE_MEMBER(ObPxBloomFilterData, filter_, tenant_id_, filter_id_,
                     server_id_, execution_id_, bloom_filter_count_);
 OB_SERIALIZE_MEMBER(ObPxDmlRowInfo, row_match_count_, row_duplicated_count_, row_deleted_count_);
+OB_SERIALIZE_MEMBER(ObPxCardFeedback, op_id_, est_rows_, actual_rows_);
+OB_SERIALIZE_MEMBER(ObPxCardFeedbackInfo, feedbacks_);
 OB_SERIALIZE_MEMBER(ObPxTabletRange, tablet_id_, range_cut_, range_weights_);
 
 int ObPxTaskChSet::assign(const ObPxTaskChSet &other)
@@ -69,6 +71,42 @@ void ObPxDmlRowInfo::set_px_dml_row_info(const ObPhysicalPlanCtx &plan_ctx)
   row_deleted_count_ = plan_ctx.get_row_deleted_count();
 }
 
+int ObPxCardFeedbackInfo::add_card_feedback(const uint64_t op_id,
+                                            const int64_t est_rows,
+                                            const int64_t actual_rows)
+{
+  int ret = OB_SUCCESS;
+  bool found = false;
+  for (int64_t i = 0; !found && i < feedbacks_.count(); ++i) {
+    if (feedbacks_.at(i).op_id_ == op_id) {
+      feedbacks_.at(i).actual_rows_ += actual_rows;
+      found = true;
+    }
+  }
+  if (!found) {
+    ObPxCardFeedback feedback;
+    feedback.op_id_ = op_id;
+    feedback.est_rows_ = est_rows;
+    feedback.actual_rows_ = actual_rows;
+    if (OB_FAIL(feedbacks_.push_back(feedback))) {
+      LOG_WARN("fail to push back card feedback", K(ret));
+    }
+  }
+  return ret;
+}
+
+int ObPxCardFeedbackInfo::add_card_feedback_info(const ObPxCardFeedbackInfo &other)
+{
+  int ret = OB_SUCCESS;
+  for (int64_t i = 0; OB_SUCC(ret) && i < other.feedbacks_.count(); ++i) {
+    const ObPxCardFeedback &feedback = other.feedbacks_.at(i);
+    if (OB_FAIL(add_card_feedback(feedback.op_id_, feedback.est_rows_, feedback.actual_rows_))) {
+      LOG_WARN("fail to add card feedback", K(ret), K(feedback));
+    }
+  }
+  return ret;
+}
+
 ObPxTabletRange::ObPxTabletRange()
   : tablet_id_(OB_INVALID_ID), range_weights_(0), range_cut_()
 {
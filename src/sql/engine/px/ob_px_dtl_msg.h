@@ -73,6 +73,35 @@ public:
   int64_t row_deleted_count_;
 };
 
+// 物化点输入的实际行数，task 汇总到 sqc，qc 再按 dfo 汇总后与估算行数比较
+struct ObPxCardFeedback
+{
+  OB_UNIS_VERSION(1);
+public:
+  ObPxCardFeedback() : op_id_(common::OB_INVALID_ID), est_rows_(0), actual_rows_(0) {}
+  ~ObPxCardFeedback() = default;
+  TO_STRING_KV(K_(op_id), K_(est_rows), K_(actual_rows));
+public:
+  uint64_t op_id_;
+  int64_t est_rows_;
+  int64_t actual_rows_;
+};
+struct ObPxCardFeedbackInfo
+{
+  OB_UNIS_VERSION(1);
+public:
+  ObPxCardFeedbackInfo() : feedbacks_() {}
+  ~ObPxCardFeedbackInfo() = default;
+  void reset() { feedbacks_.reset(); }
+  int assign(const ObPxCardFeedbackInfo &other) { return feedbacks_.assign(other.feedbacks_); }
+  // 相同算子的实际行数累加
+  int add_card_feedback(const uint64_t op_id, const int64_t est_rows, const int64_t actual_rows);
+  int add_card_feedback_info(const ObPxCardFeedbackInfo &other);
+  TO_STRING_KV(K_(feedbacks));
+public:
+  common::ObSEArray<ObPxCardFeedback, 2> feedbacks_;
+};
+
 // keep for compatiablity. never should be used anymore
 class ObPxTaskMonitorInfo
 {
@@ -378,7 +407,8 @@ public:
         sqc_affected_rows_(0),
         dml_row_info_(),
         temp_table_id_(common::OB_INVALID_ID),
-        interm_result_ids_() {}
+        interm_result_ids_(),
+        card_feedback_info_() {}
   virtual ~ObPxFinishSqcResultMsg() = default;
   const transaction::ObTxExecResult &get_trans_result() const { return trans_result_; }
   transaction::ObTxExecResult &get_trans_result() { return trans_result_; }
@@ -390,6 +420,7 @@ public:
     trans_result_.reset();
     task_monitor_info_array_.reset();
     dml_row_info_.reset();
+    card_feedback_info_.reset();
   }
   TO_STRING_KV(K_(dfo_id), K_(sqc_id), K_(rc), K_(sqc_affected_rows));
 public:
@@ -402,6 +433,7 @@ public:
   ObPxDmlRowInfo dml_row_info_; // SQC存在DML算子时, 需要统计行 信息
   uint64_t temp_table_id_;
   ObSEArray<uint64_t, 8> interm_result_ids_;
+  ObPxCardFeedbackInfo card_feedback_info_; // SQC内所有task物化点的实际行数
 };
 
 class ObPxFinishTaskResultMsg
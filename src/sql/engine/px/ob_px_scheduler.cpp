@@ -253,6 +253,22 @@ int ObPxMsgProc::on_sqc_init_msg(ObExecContext &ctx, const ObPxInitSqcResultMsg
 //        - 如果所有 dfo 都已调度完成 (不考虑 Coord)，nop
 //    否则：
 //      - nop
+// 所有 sqc 结束后，dfo 内物化点的实际行数才是完整的，此时与估算行数比较
+void ObPxMsgProc::check_card_feedback(ObDfo &dfo)
+{
+  const ObOpSpec *root_spec = dfo.get_root_op_spec();
+  if (OB_NOT_NULL(root_spec) && OB_NOT_NULL(root_spec->plan_)) {
+    const ObPxCardFeedbackInfo &info = dfo.get_card_feedback_info();
+    for (int64_t i = 0; i < info.feedbacks_.count(); ++i) {
+      const ObPxCardFeedback &feedback = info.feedbacks_.at(i);
+      root_spec->plan_->check_card_misestimate(feedback.op_id_,
+                                               feedback.est_rows_,
+                                               feedback.actual_rows_,
+                                               1 /*scan_times*/);
+    }
+  }
+}
+
 int ObPxMsgProc::on_sqc_finish_msg(ObExecContext &ctx,
                                    const ObPxFinishSqcResultMsg &pkt)
 {
@@ -306,6 +322,12 @@ int ObPxMsgProc::on_sqc_finish_msg(ObExecContext &ctx,
           phy_plan_ctx->get_timeout_timestamp(),
           sqc->get_exec_addr()));
     }
+    // 需在判断 dfo 是否结束之前累加，否则最后一个 sqc 的行数不会被检查
+    if (OB_SUCCESS == pkt.rc_
+        && OB_SUCCESS != edge->get_card_feedback_info().add_card_feedback_info(
+                            pkt.card_feedback_info_)) {
+      LOG_WARN("fail to add card feedback info", K(pkt.card_feedback_info_));
+    }
     NG_TRACE_EXT(sqc_finish,
                  OB_ID(dfo_id), sqc->get_dfo_id(),
                  OB_ID(sqc_id), sqc->get_sqc_id());
@@ -336,6 +358,7 @@ int ObPxMsgProc::on_sqc_finish_msg(ObExecContext &ctx,
       if (OB_SUCC(ret) && sqc_threads_finish) {
         edge->set_thread_finish(true);
         edge->set_used_worker_count(dfo_used_worker_count);
+        check_card_feedback(*edge);
         LOG_TRACE("[MSG] dfo finish", K(*edge));
       }
     }
@@ -158,6 +158,7 @@ public:
   // end DATAHUB msg processing
 private:
   int do_cleanup_dfo(ObDfo &dfo);
+  void check_card_feedback(ObDfo &dfo);
   int fast_dispatch_sqc(ObExecContext &exec_ctx,
                         ObDfo &dfo,
                         ObArray<ObPxSqcMeta *> &sqcs);
@@ -397,6 +397,10 @@ int ObPxSQCProxy::report(int end_ret) const
     update_error_code(sqc_ret, task.get_result());
     affected_rows += task.get_affected_rows();
     finish_msg.dml_row_info_.add_px_dml_row_info(task.dml_row_info_);
+    if (OB_SUCCESS != finish_msg.card_feedback_info_.add_card_feedback_info(
+                        task.card_feedback_info_)) {
+      LOG_WARN("fail to add card feedback info", K(task.card_feedback_info_));
+    }
     finish_msg.temp_table_id_ = task.temp_table_id_;
     if (OB_NOT_NULL(session)) {
       transaction::ObTxDesc *&sqc_tx_desc = session->get_tx_desc();
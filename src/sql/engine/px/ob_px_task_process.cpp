@@ -304,6 +304,14 @@ int ObPxTaskProcess::execute(ObOpSpec &root_spec)
       arg_.sqc_task_ptr_->set_affected_rows(ctx.get_physical_plan_ctx()->get_affected_rows());
       arg_.sqc_task_ptr_->dml_row_info_.set_px_dml_row_info(*ctx.get_physical_plan_ctx());
       LOG_TRACE("the affected row from sqc task", K(arg_.sqc_task_ptr_->get_affected_rows()));
+      // 物化点的行数由 qc 按 dfo 汇总后判断基数是否估算错误
+      if (GCONF._enable_cardinality_feedback) {
+        int tmp_ret = OB_SUCCESS;
+        if (OB_SUCCESS != (tmp_ret = collect_card_feedback(
+                           *root, arg_.sqc_task_ptr_->card_feedback_info_))) {
+          LOG_WARN("fail to collect card feedback", K(tmp_ret));
+        }
+      }
     }
     // record ret code
     if (OB_FAIL(ret)) {
@@ -473,6 +481,29 @@ int ObPxTaskProcess::do_process()
   return ret;
 }
 
+int ObPxTaskProcess::collect_card_feedback(ObOperator &op, ObPxCardFeedbackInfo &info)
+{
+  int ret = OB_SUCCESS;
+  uint64_t op_id = OB_INVALID_ID;
+  int64_t est_rows = 0;
+  int64_t output_rows = 0;
+  int64_t scan_times = 0;
+  // 各 task 单次扫描的行数之和即为整个 dfo 单次扫描的行数
+  if (op.get_card_feedback(op_id, est_rows, output_rows, scan_times)
+      && OB_FAIL(info.add_card_feedback(op_id, est_rows, output_rows / scan_times))) {
+    LOG_WARN("fail to add card feedback", K(ret), K(op_id));
+  }
+  for (int32_t i = 0; OB_SUCC(ret) && i < op.get_child_cnt(); ++i) {
+    if (OB_ISNULL(op.get_child(i))) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("child op is null", K(ret), K(i));
+    } else if (OB_FAIL(collect_card_feedback(*op.get_child(i), info))) {
+      LOG_WARN("fail to collect card feedback", K(ret), K(i));
+    }
+  }
+  return ret;
+}
+
 int ObPxTaskProcess::record_tx_desc()
 {
   int ret = OB_SUCCESS;
@@ -25,6 +25,7 @@
 #include "ob_opt_est_parameter_vector.h"
 #include "share/stat/ob_opt_stat_manager.h"
 #include "ob_opt_est_cost_model_vector.h"
+#include "lib/lock/ob_spin_lock.h"
 
 using namespace oceanbase::common;
 using namespace oceanbase::share;
@@ -35,8 +36,99 @@ using namespace oceanbase::jit::expr;
 // using share::schema::ObSchemaGetterGuard;
 
 const int64_t ObOptEstCost::MAX_STORAGE_RANGE_ESTIMATION_NUM = 10;
-ObOptEstCostModel normal_model_(comparison_params_normal, hash_params_normal, cost_params_normal);
-ObOptEstVectorCostModel vector_model_(comparison_params_vector, hash_params_vector, cost_params_vector);
+
+// costs used by the models, the fitted defaults scaled to the hardware of this server
+struct ObScaledCostParams
+{
+  ObScaledCostParams(const double (&comparison_params)[ObMaxTC + 1],
+                     const double (&hash_params)[ObMaxTC + 1],
+                     const ObOptEstCostModel::ObCostParams &cost_params)
+    : base_comparison_params_(comparison_params),
+      base_hash_params_(hash_params),
+      base_cost_params_(cost_params),
+      cost_params_(cost_params)
+  {
+    MEMCPY(comparison_params_, comparison_params, sizeof(comparison_params_));
+    MEMCPY(hash_params_, hash_params, sizeof(hash_params_));
+  }
+  void scale(const double cpu_scale, const double seq_io_scale, const double rnd_io_scale)
+  {
+    for (int64_t i = 0; i <= ObMaxTC; ++i) {
+      comparison_params_[i] = base_comparison_params_[i] > 0
+          ? base_comparison_params_[i] * cpu_scale : base_comparison_params_[i];
+      hash_params_[i] = base_hash_params_[i] > 0
+          ? base_hash_params_[i] * cpu_scale : base_hash_params_[i];
+    }
+    cost_params_.scale_from(base_cost_params_, cpu_scale, seq_io_scale, rnd_io_scale);
+  }
+  const double (&base_comparison_params_)[ObMaxTC + 1];
+  const double (&base_hash_params_)[ObMaxTC + 1];
+  const ObOptEstCostModel::ObCostParams &base_cost_params_;
+  double comparison_params_[ObMaxTC + 1];
+  double hash_params_[ObMaxTC + 1];
+  ObOptEstCostModel::ObCostParams cost_params_;
+};
+
+// a normal and a vector model over one set of scaled params
+struct ObScaledCostModels
+{
+  ObScaledCostModels()
+    : normal_params_(comparison_params_normal, hash_params_normal, cost_params_normal),
+      vector_params_(comparison_params_vector, hash_params_vector, cost_params_vector),
+      normal_model_(normal_params_.comparison_params_,
+                    normal_params_.hash_params_,
+                    normal_params_.cost_params_),
+      vector_model_(vector_params_.comparison_params_,
+                    vector_params_.hash_params_,
+                    vector_params_.cost_params_)
+  { }
+  ObScaledCostParams normal_params_;
+  ObScaledCostParams vector_params_;
+  ObOptEstCostModel normal_model_;
+  ObOptEstVectorCostModel vector_model_;
+};
+
+// set_cost_scale rebuilds the slot not in use and then publishes it, so the
+// optimizer never sees a half scaled set of params while estimating.
+static ObScaledCostModels cost_models_[2];
+static ObScaledCostModels *cur_cost_models_ = &cost_models_[0];
+static ObSpinLock cost_scale_lock_;
+static double cpu_cost_scale_ = 1.0;
+static double seq_io_cost_scale_ = 1.0;
+static double rnd_io_cost_scale_ = 1.0;
+
+void ObOptEstCost::set_cost_scale(const double cpu_scale,
+                                  const double seq_io_scale,
+                                  const double rnd_io_scale)
+{
+  ObSpinLockGuard guard(cost_scale_lock_);
+  if (cpu_scale != cpu_cost_scale_
+      || seq_io_scale != seq_io_cost_scale_
+      || rnd_io_scale != rnd_io_cost_scale_) {
+    // plans in cache keep the costs they were chosen with until they are regenerated
+    LOG_INFO("optimizer cost scale changed", "orig_cpu_scale", cpu_cost_scale_,
+             "orig_seq_io_scale", seq_io_cost_scale_, "orig_rnd_io_scale", rnd_io_cost_scale_,
+             K(cpu_scale), K(seq_io_scale), K(rnd_io_scale));
+    ObScaledCostModels *next = (cur_cost_models_ == &cost_models_[0])
+                               ? &cost_models_[1] : &cost_models_[0];
+    next->normal_params_.scale(cpu_scale, seq_io_scale, rnd_io_scale);
+    next->vector_params_.scale(cpu_scale, seq_io_scale, rnd_io_scale);
+    ATOMIC_STORE(&cur_cost_models_, next);
+    cpu_cost_scale_ = cpu_scale;
+    seq_io_cost_scale_ = seq_io_scale;
+    rnd_io_cost_scale_ = rnd_io_scale;
+    LOG_INFO("optimizer cost params after scale",
+             "normal_micro_block_seq_cost", next->normal_params_.cost_params_.MICRO_BLOCK_SEQ_COST,
+             "normal_micro_block_rnd_cost", next->normal_params_.cost_params_.MICRO_BLOCK_RND_COST,
+             "normal_fetch_row_rnd_cost", next->normal_params_.cost_params_.FETCH_ROW_RND_COST,
+             "normal_cpu_tuple_cost", next->normal_params_.cost_params_.CPU_TUPLE_COST,
+             "normal_cmp_int_cost", next->normal_params_.cost_params_.CMP_INT_COST,
+             "normal_build_hash_per_row_cost", next->normal_params_.cost_params_.BUILD_HASH_PER_ROW_COST,
+             "vector_micro_block_seq_cost", next->vector_params_.cost_params_.MICRO_BLOCK_SEQ_COST,
+             "vector_micro_block_rnd_cost", next->vector_params_.cost_params_.MICRO_BLOCK_RND_COST,
+             "vector_cpu_tuple_cost", next->vector_params_.cost_params_.CPU_TUPLE_COST);
+  }
+}
 
 int ObOptEstCost::cost_nestloop(const ObCostNLJoinInfo &est_cost_info,
                                 double &cost,
@@ -695,9 +787,10 @@ const char * ObOptEstCost::get_method_name(const RowCountEstMethod method)
 
 ObOptEstCostModel &ObOptEstCost::get_model(MODEL_TYPE model_type)
 {
+  ObScaledCostModels *models = ATOMIC_LOAD(&cur_cost_models_);
   if (VECTOR_MODEL == model_type) {
-    return vector_model_;
+    return models->vector_model_;
   } else {
-    return normal_model_;
+    return models->normal_model_;
   }
 }
@@ -207,6 +207,11 @@ public:
   static const char *get_method_name(const RowCountEstMethod method);
 
   static double get_estimate_width_from_type(const ObExprResType &type);
+
+  // scale the cpu, sequential io and random io costs of both models, 1 means the defaults
+  static void set_cost_scale(const double cpu_scale,
+                             const double seq_io_scale,
+                             const double rnd_io_scale);
 private:
   static ObOptEstCostModel &get_model(MODEL_TYPE model_type);
   // static ObOptEstCostModel normal_model_;
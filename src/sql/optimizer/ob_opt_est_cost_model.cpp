@@ -30,6 +30,49 @@ const int64_t ObOptEstCostModel::DEFAULT_LOCAL_ORDER_DEGREE = 32;
 const int64_t ObOptEstCostModel::DEFAULT_MAX_STRING_WIDTH = 64;
 const int64_t ObOptEstCostModel::DEFAULT_FIXED_OBJ_WIDTH = 12;
 
+void ObOptEstCostModel::ObCostParams::scale_from(const ObCostParams &base,
+                                                 const double cpu_scale,
+                                                 const double seq_io_scale,
+                                                 const double rnd_io_scale)
+{
+  // invalid costs are negative and kept as is
+  #define SCALE_COST(cost, scale) cost = base.cost > 0 ? base.cost * (scale) : base.cost
+  *this = base;
+  SCALE_COST(CPU_TUPLE_COST, cpu_scale);
+  SCALE_COST(TABLE_SCAN_CPU_TUPLE_COST, cpu_scale);
+  SCALE_COST(PROJECT_COLUMN_SEQ_INT_COST, cpu_scale);
+  SCALE_COST(PROJECT_COLUMN_SEQ_NUMBER_COST, cpu_scale);
+  SCALE_COST(PROJECT_COLUMN_SEQ_CHAR_COST, cpu_scale);
+  SCALE_COST(PROJECT_COLUMN_RND_INT_COST, cpu_scale);
+  SCALE_COST(PROJECT_COLUMN_RND_NUMBER_COST, cpu_scale);
+  SCALE_COST(PROJECT_COLUMN_RND_CHAR_COST, cpu_scale);
+  SCALE_COST(CMP_DEFAULT_COST, cpu_scale);
+  SCALE_COST(CMP_INT_COST, cpu_scale);
+  SCALE_COST(CMP_NUMBER_COST, cpu_scale);
+  SCALE_COST(CMP_CHAR_COST, cpu_scale);
+  SCALE_COST(HASH_DEFAULT_COST, cpu_scale);
+  SCALE_COST(HASH_INT_COST, cpu_scale);
+  SCALE_COST(HASH_NUMBER_COST, cpu_scale);
+  SCALE_COST(HASH_CHAR_COST, cpu_scale);
+  SCALE_COST(MATERIALIZE_PER_BYTE_WRITE_COST, cpu_scale);
+  SCALE_COST(READ_MATERIALIZED_PER_ROW_COST, cpu_scale);
+  SCALE_COST(PER_AGGR_FUNC_COST, cpu_scale);
+  SCALE_COST(PER_WIN_FUNC_COST, cpu_scale);
+  SCALE_COST(CPU_OPERATOR_COST, cpu_scale);
+  SCALE_COST(JOIN_PER_ROW_COST, cpu_scale);
+  SCALE_COST(BUILD_HASH_PER_ROW_COST, cpu_scale);
+  SCALE_COST(PROBE_HASH_PER_ROW_COST, cpu_scale);
+  SCALE_COST(RESCAN_COST, cpu_scale);
+  SCALE_COST(MICRO_BLOCK_SEQ_COST, seq_io_scale);
+  SCALE_COST(MICRO_BLOCK_RND_COST, rnd_io_scale);
+  SCALE_COST(FETCH_ROW_RND_COST, rnd_io_scale);
+  SCALE_COST(NL_SCAN_COST, rnd_io_scale);
+  SCALE_COST(BATCH_NL_SCAN_COST, rnd_io_scale);
+  SCALE_COST(NL_GET_COST, rnd_io_scale);
+  SCALE_COST(BATCH_NL_GET_COST, rnd_io_scale);
+  #undef SCALE_COST
+}
+
 int ObCostTableScanInfo::assign(const ObCostTableScanInfo &est_cost_info)
 {
   int ret = OB_SUCCESS;
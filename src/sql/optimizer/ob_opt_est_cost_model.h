@@ -685,6 +685,12 @@ public:
       DELETE_INDEX_PER_ROW_COST(DEFAULT_DELETE_INDEX_PER_ROW_COST),
       DELETE_CHECK_PER_ROW_COST(DEFAULT_DELETE_CHECK_PER_ROW_COST)
     {}
+    // rebuild from base with the hardware dependent costs multiplied by the given ratios,
+    // network, px rescan and dml costs are taken from base as is
+    void scale_from(const ObCostParams &base,
+                    const double cpu_scale,
+                    const double seq_io_scale,
+                    const double rnd_io_scale);
     /** 读取一行的CPU开销，基本上只包括get_next_row()操作 */
     double CPU_TUPLE_COST;
     /** 存储层吐出一行的代价 **/
@@ -15,6 +15,9 @@
 #include "share/ob_define.h"
 #include "lib/ash/ob_active_session_guard.h"
 #include "lib/worker.h"
+#if defined(__x86_64__)
+#include <emmintrin.h>
+#endif
 
 using namespace oceanbase::sql;
 using namespace oceanbase::common;
@@ -73,6 +76,34 @@ inline int64_t ObFastParserBase::ObRawSql::strncasecmp(
   return 0;
 }
 
+bool ObFastParserBase::ObRawSql::use_sse2_ = true;
+
+inline char ObFastParserBase::ObRawSql::scan_until(const char c1, const char c2)
+{
+  int64_t pos = cur_pos_;
+#if defined(__x86_64__)
+  // sse2 is always there on x86_64
+  if (use_sse2_) {
+    const __m128i v1 = _mm_set1_epi8(c1);
+    const __m128i v2 = _mm_set1_epi8(c2);
+    while (pos + 16 <= raw_sql_len_) {
+      const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(raw_sql_ + pos));
+      const int mask = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(v, v1),
+                                                      _mm_cmpeq_epi8(v, v2)));
+      if (0 != mask) {
+        pos += __builtin_ctz(mask);
+        break;
+      }
+      pos += 16;
+    }
+  }
+#endif
+  while (pos < raw_sql_len_ && c1 != raw_sql_[pos] && c2 != raw_sql_[pos]) {
+    ++pos;
+  }
+  return scan(pos - cur_pos_);
+}
+
 ObFastParserBase::ObFastParserBase(
   ObIAllocator &allocator,
   const ObCollationType connection_collation,
@@ -1354,7 +1385,9 @@ int ObFastParserBase::process_comment_content()
   bool is_match = false;
   char ch = raw_sql_.scan();
   while (!raw_sql_.is_search_end()) {
-    if ('*' == ch && '/' == raw_sql_.peek()) {
+    if ('*' != ch) {
+      ch = raw_sql_.scan_until('*', '*');
+    } else if ('/' == raw_sql_.peek()) {
       // scan '\/'
       raw_sql_.scan();
       is_match = true;
@@ -1834,8 +1867,8 @@ int ObFastParserMysql::process_string(const char quote)
     while (OB_SUCC(ret) && !raw_sql_.is_search_end()) {
       ch = raw_sql_.scan();
       int64_t copy_begin_pos = raw_sql_.cur_pos_;
-      while (!raw_sql_.is_search_end() && '\\' != ch && quote != ch) {
-        ch = raw_sql_.scan();
+      if (!raw_sql_.is_search_end()) {
+        ch = raw_sql_.scan_until('\\', quote);
       }
       int64_t len = raw_sql_.cur_pos_ - copy_begin_pos;
       if (len > 0) {
@@ -2305,8 +2338,8 @@ int ObFastParserOracle::process_string(const bool in_q_quote)
     while (OB_SUCC(ret) && !raw_sql_.is_search_end()) {
       ch = raw_sql_.scan();
       int64_t copy_begin_pos = raw_sql_.cur_pos_;
-      while (!raw_sql_.is_search_end() && '\\' != ch && '\'' != ch) {
-        ch = raw_sql_.scan();
+      if (!raw_sql_.is_search_end()) {
+        ch = raw_sql_.scan_until('\\', '\'');
       }
       int64_t len = raw_sql_.cur_pos_ - copy_begin_pos;
       if (len > 0) {
@@ -111,6 +111,9 @@ protected:
 			return raw_sql_[cur_pos_];
 		}
 		inline char scan() { return scan(1); }
+		// move to the first c1 or c2 at or after cur_pos_, return it or INVALID_CHAR
+		// at the end. Long literals and comments are skipped 16 bytes at a time.
+		char scan_until(const char c1, const char c2);
 		inline char reverse_scan()
 		{
 			if (cur_pos_ <= 0 || cur_pos_ >= raw_sql_len_ + 1) {
@@ -153,6 +156,8 @@ protected:
 		int64_t raw_sql_len_;
 		int64_t cur_pos_;
 		bool search_end_;
+		// scan_until uses sse2 on x86_64, only turned off to benchmark the scalar loop
+		static bool use_sse2_;
 	};
 
 protected:
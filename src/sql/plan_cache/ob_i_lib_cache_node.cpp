@@ -153,8 +153,12 @@ int ObILibCacheNode::lock(bool is_rdlock)
 int ObILibCacheNode::update_node_stat(ObILibCacheCtx &ctx)
 {
   int ret = OB_SUCCESS;
-  ATOMIC_STORE(&(node_stat_.last_active_timestamp_), ObTimeUtility::current_time());
-  ATOMIC_INC(&(node_stat_.execute_count_));
+  // every hit of a hot statement comes here, only dirty the node when the
+  // timestamp is stale enough to matter for eviction weight
+  const int64_t cur_time = ObTimeUtility::current_time();
+  if (cur_time - ATOMIC_LOAD(&(node_stat_.last_active_timestamp_)) >= ACTIVE_TS_REFRESH_INTERVAL) {
+    ATOMIC_STORE(&(node_stat_.last_active_timestamp_), cur_time);
+  }
   return ret;
 }
 
@@ -41,7 +41,6 @@ struct StmtStat
   int64_t execute_average_time_;
   int64_t execute_slowest_time_;
   int64_t execute_slowest_timestamp_;
-  int64_t execute_count_;                   // used now
   int64_t execute_slow_count_;
   int64_t ps_count_;
   bool to_delete_;
@@ -51,7 +50,6 @@ struct StmtStat
         execute_average_time_(0),
         execute_slowest_time_(0),
         execute_slowest_timestamp_(0),
-        execute_count_(0),
         execute_slow_count_(0),
         ps_count_(0),
         to_delete_(false)
@@ -65,7 +63,6 @@ struct StmtStat
     execute_average_time_ = 0;
     execute_slowest_time_ = 0;
     execute_slowest_timestamp_ = 0;
-    execute_count_ = 0;
     execute_slow_count_ = 0;
     ps_count_ = 0;
     to_delete_ = false;
@@ -83,7 +80,6 @@ struct StmtStat
                K_(execute_average_time),
                K_(execute_slowest_time),
                K_(execute_slowest_timestamp),
-               K_(execute_count),
                K_(execute_slow_count),
                K_(ps_count),
                K_(to_delete));
@@ -97,6 +93,7 @@ class ObILibCacheNode
 {
 friend class ObLCNodeFactory;
 public:
+  static const int64_t ACTIVE_TS_REFRESH_INTERVAL = 10 * 1000L; // 10ms
   ObILibCacheNode(ObPlanCache *lib_cache, lib::MemoryContext &mem_context)
     : mem_context_(mem_context),
       allocator_(mem_context->get_safe_arena_allocator()),
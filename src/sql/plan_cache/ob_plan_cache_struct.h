@@ -17,6 +17,7 @@
 #include "lib/container/ob_se_array.h"
 #include "lib/hash/ob_hashmap.h"
 #include "lib/hash_func/murmur_hash.h"
+#include "lib/metrics/ob_counter.h"
 #include "lib/time/ob_time_utility.h"
 #include "lib/allocator/ob_allocator.h"
 #include "lib/string/ob_string.h"
@@ -401,18 +402,19 @@ struct ObPlanCacheCtx : public ObILibCacheCtx
   ParamStore *ab_params_;  // arraybinding batch parameters,
 };
 
+// bumped by every plan cache lookup of the tenant, keep them per cpu
 struct ObPlanCacheStat
 {
-  uint64_t access_count_;
-  uint64_t hit_count_;
+  common::ObPCAlignedCounter access_count_;
+  common::ObPCAlignedCounter hit_count_;
 
   ObPlanCacheStat()
-    : access_count_(0),
-      hit_count_(0)
+    : access_count_(),
+      hit_count_()
   {}
 
-  TO_STRING_KV("access_count", access_count_,
-               "hit_count", hit_count_);
+  TO_STRING_KV("access_count", access_count_.value(),
+               "hit_count", hit_count_.value());
 };
 
 }
@@ -172,6 +172,10 @@ int ObBlockRowStore::filter_micro_block(
     LOG_WARN("Unexpected null filter bitmap", K(ret));
   } else if (nullptr != parent && OB_FAIL(parent->prepare_skip_filter())) {
     LOG_WARN("Failed to check parent blockscan", K(ret));
+  } else if (filter->is_filter_black_node()
+             && static_cast<sql::ObBlackFilterExecutor *>(filter)->is_pass_through(row_count)) {
+    // runtime join filter is not ready, skip decoding the micro block for it
+    result->reuse(true);
   } else if (filter->is_filter_node()) {
     if (OB_FAIL(micro_scanner.filter_pushdown_filter(parent, filter, pd_filter_info_, *result))) {
       LOG_WARN("Failed to filter pushdown filter", K(ret), KPC(filter));
@@ -336,19 +336,21 @@ int ObIndexTreePrefetcher::prefetch_block_data(
     micro_handle.micro_info_.size_ = index_block_info.get_block_size();
     if (need_submit_io) {
       ObMacroBlockHandle macro_handle;
+      bool is_inflight_io_owner = false;
       if (is_data) {
         const ObTableReadInfo *data_read_info = iter_param_->get_full_read_info();
         if (OB_ISNULL(data_read_info)) {
           ret = OB_ERR_UNEXPECTED;
           LOG_WARN("Unexpected null full_col_descs", K(ret), KPC_(iter_param));
-        } else if (OB_FAIL(data_block_cache_->prefetch(
+        } else if (OB_FAIL(data_block_cache_->prefetch_shared(
                     tenant_id,
                     macro_id,
                     index_block_info,
                     access_ctx_->query_flag_,
                     *data_read_info,
                     iter_param_->tablet_handle_,
-                    macro_handle))) {
+                    macro_handle,
+                    is_inflight_io_owner))) {
           LOG_WARN("Fail to prefetch micro block", K(ret), K(index_block_info), K(macro_handle), K(micro_handle), KPC(data_read_info));
         }
       } else if (OB_FAIL(index_block_cache_->prefetch(
@@ -366,6 +368,15 @@ int ObIndexTreePrefetcher::prefetch_block_data(
         micro_handle.macro_block_id_ = macro_id;
         micro_handle.block_state_ = ObSSTableMicroBlockState::IN_BLOCK_IO;
         micro_handle.io_handle_ = macro_handle;
+        if (is_inflight_io_owner) {
+          micro_handle.inflight_io_cache_ = data_block_cache_;
+        }
+      } else if (is_inflight_io_owner) {
+        // the handle does not keep this io, nobody would withdraw it
+        data_block_cache_->remove_inflight_io(ObMicroBlockCacheKey(tenant_id,
+                                                                   macro_id,
+                                                                   index_block_info.get_block_offset(),
+                                                                   index_block_info.get_block_size()));
       }
     }
   }
@@ -863,10 +863,72 @@ int ObDataMicroBlockCache::get_allocator(common::ObIAllocator *&allocator)
 
 void ObDataMicroBlockCache::destroy()
 {
+  for (int64_t i = 0; i < INFLIGHT_IO_SLOT_CNT; ++i) {
+    ObSpinLockGuard guard(inflight_ios_[i].lock_);
+    inflight_ios_[i].macro_handle_.reset();
+  }
   common::ObKVCache<ObMicroBlockCacheKey, ObMicroBlockCacheValue>::destroy();
   allocator_.destroy();
 }
 
+int ObDataMicroBlockCache::prefetch_shared(
+    const uint64_t tenant_id,
+    const MacroBlockId &macro_id,
+    const ObMicroIndexInfo& idx_row,
+    const common::ObQueryFlag &flag,
+    const ObTableReadInfo &full_read_info,
+    const ObTabletHandle &tablet_handle,
+    ObMacroBlockHandle &macro_handle,
+    bool &is_owner)
+{
+  int ret = OB_SUCCESS;
+  const ObMicroBlockCacheKey key(tenant_id, macro_id, idx_row.get_block_offset(), idx_row.get_block_size());
+  is_owner = false;
+  if (OB_SUCCESS == get_inflight_io(key, macro_handle)) {
+    // another scan is reading this block, wait for its io instead of issuing one
+  } else if (OB_FAIL(prefetch(tenant_id, macro_id, idx_row, flag, full_read_info, tablet_handle, macro_handle))) {
+    LOG_WARN("Fail to prefetch micro block", K(ret), K(key), K(macro_handle));
+  } else {
+    put_inflight_io(key, macro_handle);
+    is_owner = true;
+  }
+  return ret;
+}
+
+int ObDataMicroBlockCache::get_inflight_io(
+    const ObMicroBlockCacheKey &key,
+    ObMacroBlockHandle &macro_handle)
+{
+  int ret = OB_SUCCESS;
+  ObInflightIO &slot = inflight_ios_[key.hash() % INFLIGHT_IO_SLOT_CNT];
+  ObSpinLockGuard guard(slot.lock_);
+  if (!slot.macro_handle_.is_valid() || !(slot.key_ == key)) {
+    ret = OB_ENTRY_NOT_EXIST;
+  } else {
+    macro_handle = slot.macro_handle_;
+  }
+  return ret;
+}
+
+void ObDataMicroBlockCache::put_inflight_io(
+    const ObMicroBlockCacheKey &key,
+    const ObMacroBlockHandle &macro_handle)
+{
+  ObInflightIO &slot = inflight_ios_[key.hash() % INFLIGHT_IO_SLOT_CNT];
+  ObSpinLockGuard guard(slot.lock_);
+  slot.key_ = key;
+  slot.macro_handle_ = macro_handle;
+}
+
+void ObDataMicroBlockCache::remove_inflight_io(const ObMicroBlockCacheKey &key)
+{
+  ObInflightIO &slot = inflight_ios_[key.hash() % INFLIGHT_IO_SLOT_CNT];
+  ObSpinLockGuard guard(slot.lock_);
+  if (slot.key_ == key) {
+    slot.macro_handle_.reset();
+  }
+}
+
 /*-----------------------------------ObDataMicroBlockIOCallback-----------------------------------*/
 ObDataMicroBlockCache::ObDataMicroBlockIOCallback::ObDataMicroBlockIOCallback()
   : ObIMicroBlockIOCallback(),
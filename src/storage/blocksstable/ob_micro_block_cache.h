@@ -12,6 +12,7 @@
 
 #ifndef OCEANBASE_STORAGE_BLOCKSSTABLE_MICRO_BLOCK_CACHE_H_
 #define OCEANBASE_STORAGE_BLOCKSSTABLE_MICRO_BLOCK_CACHE_H_
+#include "lib/lock/ob_spin_lock.h"
 #include "share/io/ob_io_manager.h"
 #include "share/cache/ob_kv_storecache.h"
 #include "ob_block_sstable_struct.h"
@@ -281,6 +282,22 @@ public:
       ObIAllocator *allocator) override;
   virtual int get_cache(BaseBlockCache *&cache) override;
   virtual int get_allocator(common::ObIAllocator *&allocator) override;
+  // Scans which miss the cache on a micro block that another scan is reading share its io,
+  // so the block is read, decrypted and decompressed once. The io is published by the
+  // scan which submits it and withdrawn when that scan releases the block.
+  // is_owner is set if the io was submitted and published by this call.
+  int prefetch_shared(
+      const uint64_t tenant_id,
+      const MacroBlockId &macro_id,
+      const ObMicroIndexInfo& idx_row,
+      const common::ObQueryFlag &flag,
+      const ObTableReadInfo &full_read_info,
+      const ObTabletHandle &tablet_handle,
+      ObMacroBlockHandle &macro_handle,
+      bool &is_owner);
+  int get_inflight_io(const ObMicroBlockCacheKey &key, ObMacroBlockHandle &macro_handle);
+  void put_inflight_io(const ObMicroBlockCacheKey &key, const ObMacroBlockHandle &macro_handle);
+  void remove_inflight_io(const ObMicroBlockCacheKey &key);
 public:
   class ObDataMicroBlockIOCallback : public ObIMicroBlockIOCallback
   {
@@ -344,7 +361,16 @@ public:
     ObMultiBlockIOResult io_result_;
   };
 private:
+  static const int64_t INFLIGHT_IO_SLOT_CNT = 1024;
+  struct ObInflightIO
+  {
+    common::ObSpinLock lock_;
+    ObMicroBlockCacheKey key_;
+    ObMacroBlockHandle macro_handle_;
+  } CACHE_ALIGNED;
   common::ObConcurrentFIFOAllocator allocator_;
+  // direct mapped by key hash, a colliding io simply replaces the slot
+  ObInflightIO inflight_ios_[INFLIGHT_IO_SLOT_CNT];
   DISALLOW_COPY_AND_ASSIGN(ObDataMicroBlockCache);
 };
 
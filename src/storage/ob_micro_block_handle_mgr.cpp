@@ -36,7 +36,8 @@ ObMicroBlockDataHandle::ObMicroBlockDataHandle()
     io_handle_(),
     allocator_(nullptr),
     loaded_index_block_data_(),
-    is_loaded_index_block_(false)
+    is_loaded_index_block_(false),
+    inflight_io_cache_(nullptr)
 {
   des_meta_.encrypt_key_ = encrypt_key_;
 }
@@ -48,6 +49,11 @@ ObMicroBlockDataHandle::~ObMicroBlockDataHandle()
 
 void ObMicroBlockDataHandle::reset()
 {
+  if (nullptr != inflight_io_cache_) {
+    ObMicroBlockCacheKey key(tenant_id_, macro_block_id_, micro_info_.offset_, micro_info_.size_);
+    inflight_io_cache_->remove_inflight_io(key);
+    inflight_io_cache_ = nullptr;
+  }
   block_state_ = ObSSTableMicroBlockState::UNKNOWN_STATE;
   tenant_id_ = 0;
   macro_block_id_.reset();
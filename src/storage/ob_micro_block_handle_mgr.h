@@ -58,6 +58,8 @@ struct ObMicroBlockDataHandle {
   ObIAllocator *allocator_;
   blocksstable::ObMicroBlockData loaded_index_block_data_;
   bool is_loaded_index_block_;
+  // the io of this block is published in this cache and shared with other scans until the handle is reset
+  blocksstable::ObDataMicroBlockCache *inflight_io_cache_;
 
 private:
   int get_loaded_block_data(blocksstable::ObMicroBlockData &block_data);
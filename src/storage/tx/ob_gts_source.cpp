@@ -35,6 +35,7 @@ void ObGtsStatistics::reset()
   tenant_id_ = 0;
   last_stat_ts_ = 0;
   gts_rpc_cnt_ = 0;
+  gts_rpc_merged_cnt_ = 0;
   get_gts_cache_cnt_ = 0;
   get_gts_with_stc_cnt_ = 0;
   try_get_gts_cache_cnt_ = 0;
@@ -62,6 +63,7 @@ void ObGtsStatistics::statistics()
       TRANS_LOG(INFO, "gts statistics",
                       K_(tenant_id),
                       "gts_rpc_cnt", ATOMIC_LOAD(&gts_rpc_cnt_),
+                      "gts_rpc_merged_cnt", ATOMIC_LOAD(&gts_rpc_merged_cnt_),
                       "get_gts_cache_cnt", ATOMIC_LOAD(&get_gts_cache_cnt_),
                       "get_gts_with_stc_cnt", ATOMIC_LOAD(&get_gts_with_stc_cnt_),
                       "try_get_gts_cache_cnt", ATOMIC_LOAD(&try_get_gts_cache_cnt_),
@@ -69,6 +71,7 @@ void ObGtsStatistics::statistics()
                       "wait_gts_elapse_cnt", ATOMIC_LOAD(&wait_gts_elapse_cnt_),
                       "try_wait_gts_elapse_cnt", ATOMIC_LOAD(&try_wait_gts_elapse_cnt_));
       ATOMIC_STORE(&gts_rpc_cnt_, 0);
+      ATOMIC_STORE(&gts_rpc_merged_cnt_, 0);
       ATOMIC_STORE(&get_gts_cache_cnt_, 0);
       ATOMIC_STORE(&get_gts_with_stc_cnt_, 0);
       ATOMIC_STORE(&try_get_gts_cache_cnt_, 0);
@@ -93,6 +96,8 @@ void ObGtsSource::reset()
     queue_[i].reset();
   }
   gts_cache_leader_.reset();
+  inflight_rpc_ts_ = 0;
+  pending_stc_ = 0;
 }
 
 
@@ -177,12 +182,9 @@ int ObGtsSource::get_gts(ObTsCbTask *task, int64_t &gts)
       TRANS_LOG(ERROR, "gts task push error", "ret", tmp_ret, KP(task));
       //overwrite retcode
       ret = tmp_ret;
-    } else {
-      const bool need_refresh_gts_location = false;
-      if (OB_SUCCESS != (tmp_ret = refresh_gts_(need_refresh_gts_location))) {
-        if (EXECUTE_COUNT_PER_SEC(16)) {
-          TRANS_LOG(WARN, "refresh gts failed", K(tmp_ret));
-        }
+    } else if (OB_SUCCESS != (tmp_ret = refresh_gts_pipelined_(MonotonicTs::current_time()))) {
+      if (EXECUTE_COUNT_PER_SEC(16)) {
+        TRANS_LOG(WARN, "refresh gts failed", K(tmp_ret));
       }
     }
   }
@@ -245,7 +247,7 @@ int ObGtsSource::get_gts(const MonotonicTs stc,
     } else {
       // If not in local, refresh gts
       if (need_send_rpc) {
-        if (OB_SUCCESS != (tmp_ret = query_gts_(leader))) {
+        if (OB_SUCCESS != (tmp_ret = query_gts_pipelined_(leader, stc))) {
           TRANS_LOG(WARN, "query gts fail", K(tmp_ret), K(leader));
         }
       }
@@ -435,10 +437,9 @@ int ObGtsSource::wait_gts_elapse(const int64_t ts, ObTsCbTask *task, bool &need_
       }
       if (OB_SUCCESS == ret) {
         // ignore error code
-        const bool need_refresh_gts_location = false;
-        if (OB_SUCCESS != (tmp_ret = refresh_gts_(need_refresh_gts_location))) {
+        if (OB_SUCCESS != (tmp_ret = refresh_gts_pipelined_(MonotonicTs::current_time()))) {
           if (EXECUTE_COUNT_PER_SEC(16)) {
-            TRANS_LOG(WARN, "refresh gts failed", K(tmp_ret), K(need_refresh_gts_location));
+            TRANS_LOG(WARN, "refresh gts failed", K(tmp_ret));
           }
         }
       }
@@ -495,7 +496,7 @@ int ObGtsSource::wait_gts_elapse(const int64_t ts)
         }
       } else {
         // If the leader is not in local, gts needs to be refreshed
-        if (OB_SUCCESS != (tmp_ret = query_gts_(leader))) {
+        if (OB_SUCCESS != (tmp_ret = query_gts_pipelined_(leader, MonotonicTs::current_time()))) {
           TRANS_LOG(WARN, "refresh gts failed", K(tmp_ret));
         }
       }
@@ -612,6 +613,69 @@ int ObGtsSource::query_gts_(const ObAddr &leader)
   return ret;
 }
 
+int ObGtsSource::query_gts_pipelined_(const ObAddr &leader, const MonotonicTs stc)
+{
+  int ret = OB_SUCCESS;
+  // The stc must be recorded before checking the in-flight rpc, so that either
+  // this request sends the rpc or the response of the in-flight one sees the stc
+  (void)atomic_update(&pending_stc_, stc.mts_);
+  if (try_acquire_inflight_rpc_()) {
+    if (OB_FAIL(query_gts_(leader))) {
+      ATOMIC_STORE(&inflight_rpc_ts_, 0);
+    }
+  } else {
+    gts_statistics_.inc_gts_rpc_merged_cnt();
+  }
+  return ret;
+}
+
+int ObGtsSource::refresh_gts_pipelined_(const MonotonicTs stc)
+{
+  int ret = OB_SUCCESS;
+  ObAddr leader;
+
+  if (OB_FAIL(get_gts_leader_(leader))) {
+    if (EXECUTE_COUNT_PER_SEC(16)) {
+      TRANS_LOG(WARN, "get gts leader failed", KR(ret), K_(tenant_id));
+    }
+    (void)refresh_gts_location_();
+  } else {
+    ret = query_gts_pipelined_(leader, stc);
+  }
+
+  return ret;
+}
+
+bool ObGtsSource::try_acquire_inflight_rpc_()
+{
+  const int64_t now = MonotonicTs::current_time().mts_;
+  const int64_t inflight_rpc_ts = ATOMIC_LOAD(&inflight_rpc_ts_);
+  // the in-flight rpc may be lost, do not let it block the following requests forever
+  return (0 == inflight_rpc_ts || now - inflight_rpc_ts > GTS_RPC_INFLIGHT_TIMEOUT_US)
+         && ATOMIC_BCAS(&inflight_rpc_ts_, inflight_rpc_ts, now);
+}
+
+void ObGtsSource::on_gts_rpc_response_(const MonotonicTs srr)
+{
+  int tmp_ret = OB_SUCCESS;
+  const int64_t inflight_rpc_ts = ATOMIC_LOAD(&inflight_rpc_ts_);
+  // srr of the in-flight rpc is generated after inflight_rpc_ts, any response
+  // not older than it serves all the requests merged into the in-flight rpc
+  if (0 != inflight_rpc_ts
+      && srr.mts_ >= inflight_rpc_ts
+      && ATOMIC_BCAS(&inflight_rpc_ts_, inflight_rpc_ts, 0)) {
+    const int64_t pending_stc = ATOMIC_LOAD(&pending_stc_);
+    if (pending_stc > srr.mts_) {
+      // send the next rpc eagerly for the requests arrived after the in-flight one
+      if (OB_SUCCESS != (tmp_ret = refresh_gts_pipelined_(MonotonicTs(pending_stc)))) {
+        if (EXECUTE_COUNT_PER_SEC(16)) {
+          TRANS_LOG(WARN, "send pipelined gts rpc failed", K(tmp_ret), K(srr), K(pending_stc));
+        }
+      }
+    }
+  }
+}
+
 int ObGtsSource::refresh_gts_location_()
 {
   int ret = OB_SUCCESS;
@@ -670,6 +734,7 @@ int ObGtsSource::update_gts(const MonotonicTs srr,
     TRANS_LOG(WARN, "gts local cache update error", KR(ret), K(srr), K(gts),
               K(receive_gts_ts), K(update));
   } else {
+    on_gts_rpc_response_(srr);
     TRANS_LOG(DEBUG, "gts local cache update success", K(srr), K(gts));
   }
 
@@ -733,6 +798,8 @@ int ObGtsSource::handle_gts_err_response(const ObGtsErrResponse &err_msg)
       gts_cache_leader_.reset();
       refresh_gts_location_();
     }
+    // the in-flight rpc failed, let the following request send a new one
+    ATOMIC_STORE(&inflight_rpc_ts_, 0);
   }
   if (EXECUTE_COUNT_PER_SEC(16)) {
     TRANS_LOG(INFO, "handle gts err response", KR(ret), K(err_msg), K(*this));
@@ -45,6 +45,7 @@ public:
   int init(const uint64_t tenant_id);
   void reset();
   void inc_gts_rpc_cnt() { ATOMIC_INC(&gts_rpc_cnt_); }
+  void inc_gts_rpc_merged_cnt() { ATOMIC_INC(&gts_rpc_merged_cnt_); }
   void inc_get_gts_cache_cnt() { ATOMIC_INC(&get_gts_cache_cnt_); }
   void inc_get_gts_with_stc_cnt() { ATOMIC_INC(&get_gts_with_stc_cnt_); }
   void inc_try_get_gts_cache_cnt() { ATOMIC_INC(&try_get_gts_cache_cnt_); }
@@ -56,6 +57,8 @@ private:
   uint64_t tenant_id_;
   int64_t last_stat_ts_;
   int64_t gts_rpc_cnt_;
+  // requests served by an in-flight gts rpc instead of sending a new one
+  int64_t gts_rpc_merged_cnt_;
 
   int64_t get_gts_cache_cnt_;
   int64_t get_gts_with_stc_cnt_;
@@ -100,6 +103,10 @@ private:
   int refresh_gts_location_();
   int refresh_gts_(const bool need_refresh);
   int query_gts_(const common::ObAddr &leader);
+  int query_gts_pipelined_(const common::ObAddr &leader, const MonotonicTs stc);
+  int refresh_gts_pipelined_(const MonotonicTs stc);
+  bool try_acquire_inflight_rpc_();
+  void on_gts_rpc_response_(const MonotonicTs srr);
   void statistics_();
   int get_gts_from_local_timestamp_service_(common::ObAddr &leader,
                                             int64_t &gts,
@@ -111,6 +118,8 @@ public:
   static const int64_t WAIT_GTS_QUEUE_COUNT = 1;
   static const int64_t WAIT_GTS_QUEUE_START_INDEX = GET_GTS_QUEUE_COUNT;
   static const int64_t TOTAL_GTS_QUEUE_COUNT = GET_GTS_QUEUE_COUNT + WAIT_GTS_QUEUE_COUNT;
+  // an in-flight gts rpc without response after this time is considered lost
+  static const int64_t GTS_RPC_INFLIGHT_TIMEOUT_US = 100 * 1000;
 private:
   bool is_inited_;
   int64_t tenant_id_;
@@ -124,6 +133,11 @@ private:
   common::ObTimeInterval log_interval_;
   common::ObAddr gts_cache_leader_;
   common::ObTimeInterval refresh_location_interval_;
+  // Group gts request pipeline: at most one gts rpc is in flight, all the
+  // requests arriving meanwhile share its response, and the max stc of them
+  // is recorded so that the next rpc is sent as soon as the response arrives.
+  int64_t inflight_rpc_ts_;
+  int64_t pending_stc_;
 };
 
 } // transaction
@@ -1090,6 +1090,8 @@ int ObTxDescMgr::wait()
     int i = 0;
     bool done = false;
     while (!done && i++ < MAX_RETRY_TIMES) {
+      // released tx descs may still be retired in the map, not freed yet
+      map_.reclaim_retired();
       active_cnt = map_.alloc_cnt();
       if (!active_cnt) {
         TRANS_LOG(INFO, "txDescMgr.wait done.");
@@ -16,6 +16,7 @@
 #include "lib/ob_define.h"
 #include "lib/utility/ob_print_utils.h"
 #include "lib/container/ob_se_array.h"
+#include "lib/allocator/ob_qsync.h"
 /*
  * For Example
  * 
@@ -56,6 +57,14 @@
  *   get()          // ref++
  *   revert         // ref --; 
  *
+ *   get() walks the bucket without the bucket lock. A deleted value keeps its
+ *   next_ pointer, so a reader standing on it can still reach the rest of the
+ *   chain and a lock-free miss is authoritative. When the ref of a value drops
+ *   to zero it is put on the retire list of the map and freed later, after the
+ *   lock-free readers of the epoch it was retired in have left, nobody waits
+ *   for the readers under a bucket lock. The reclaim runs once per batch of
+ *   retired values, call reclaim_retired() to free the rest at once.
+ *
  * 5. More Attentions are as followed:
  *
  * 1) 'Key -> Value' must be 1:1，otherwise you should not use such hashmap;
@@ -72,12 +81,13 @@ template<typename Value>
 class ObTransHashLink
 {
 public:
-  ObTransHashLink() : ref_(0), prev_(NULL), next_(NULL) {}
+  ObTransHashLink() : ref_(0), prev_(NULL), next_(NULL), retire_next_(NULL) {}
   ~ObTransHashLink()
   {
     ref_ = 0;
     prev_ = NULL;
     next_ = NULL;
+    retire_next_ = NULL;
   }
   inline int inc_ref(int32_t x)
   {
@@ -94,10 +104,29 @@ public:
     }
     return ref;
   }
+  // inc ref only if the value is still referenced by someone, used by the
+  // lock-free reader to avoid reviving a value which is being freed
+  inline bool try_inc_ref()
+  {
+    bool bool_ret = false;
+    int32_t ref = ATOMIC_LOAD(&ref_);
+    while (!bool_ret && ref > 0) {
+      const int32_t old_ref = ATOMIC_VCAS(&ref_, ref, ref + 1);
+      if (old_ref == ref) {
+        bool_ret = true;
+      } else {
+        ref = old_ref;
+      }
+    }
+    return bool_ret;
+  }
   int32_t get_ref() const { return ref_; }
   int32_t ref_;
   Value *prev_;
   Value *next_;
+  // link in the retire list of the map, lock-free readers may still walk
+  // through next_ of a retired value
+  Value *retire_next_;
 };
 
 template<typename Key, typename Value, typename AllocHandle, typename LockType, int64_t BUCKETS_CNT = 64>
@@ -105,7 +134,9 @@ class ObTransHashMap
 {
  typedef common::ObSEArray<Value *, 32> ValueArray;
 public:
-  ObTransHashMap() : is_inited_(false), total_cnt_(0)
+  ObTransHashMap()
+    : is_inited_(false), total_cnt_(0), qsync_epoch_(0), retire_cnt_(0),
+      retire_list_(NULL), reclaim_list_(NULL), reclaim_lock_(0)
   {
     OB_ASSERT(BUCKETS_CNT > 0);
   }
@@ -116,24 +147,33 @@ public:
   {
     if (is_inited_) {
       // del all value from hash backet
+      Value *head = nullptr;
       Value *curr = nullptr;
       Value *next = nullptr;
       for (int64_t i = 0; i < BUCKETS_CNT; ++i) {
         {
           BucketWLockGuard guard(buckets_[i].lock_, get_itid());
 
-          curr = buckets_[i].next_;
+          head = buckets_[i].next_;
+          curr = head;
           while (OB_NOT_NULL(curr)) {
             next = curr->next_;
             del_from_bucket_(i, curr);
-            // dec ref and free curr value
-            revert(curr);
             curr = next;
           }
         }
+        // deleted values keep their next_, dec ref and free them out of the lock
+        curr = head;
+        while (OB_NOT_NULL(curr)) {
+          next = curr->next_;
+          revert(curr);
+          curr = next;
+        }
         // reset bucket
         buckets_[i].reset();
       }
+      // free all retired values before the map goes away
+      reclaim_(true);
       total_cnt_ = 0;
       is_inited_ = false;
     }
@@ -199,7 +239,8 @@ public:
         }
         value->next_ = buckets_[pos].next_;
         value->prev_ = NULL;
-        buckets_[pos].next_ = value;
+        // publish the value to lock-free readers after it is linked
+        ATOMIC_STORE(&buckets_[pos].next_, value);
         ATOMIC_INC(&total_cnt_);
       } else {
         ret = OB_ENTRY_EXIST;
@@ -224,12 +265,17 @@ public:
       TRANS_LOG(ERROR, "invalid argument", K(key), KP(value));
     } else {
       int64_t pos = key.hash() % BUCKETS_CNT;
-      BucketWLockGuard guard(buckets_[pos].lock_, get_itid());
-      if (buckets_[pos].next_ != value &&
-          (NULL == value->prev_ && NULL == value->next_)) {
-        // do nothing
-      } else {
-        del_from_bucket_(pos, value);
+      bool need_revert = false;
+      {
+        BucketWLockGuard guard(buckets_[pos].lock_, get_itid());
+        if (buckets_[pos].next_ != value && NULL == value->prev_) {
+          // do nothing
+        } else {
+          del_from_bucket_(pos, value);
+          need_revert = true;
+        }
+      }
+      if (need_revert) {
         revert(value);
       }
     }
@@ -240,19 +286,19 @@ public:
   {
     if (curr == buckets_[pos].next_) {
       if (NULL == curr->next_) {
-        buckets_[pos].next_ = NULL;
+        ATOMIC_STORE(&buckets_[pos].next_, NULL);
       } else {
-        buckets_[pos].next_ = curr->next_;
+        ATOMIC_STORE(&buckets_[pos].next_, curr->next_);
         curr->next_->prev_ = curr->prev_;
       }
     } else {
-      curr->prev_->next_ = curr->next_;
+      ATOMIC_STORE(&curr->prev_->next_, curr->next_);
       if (NULL != curr->next_) {
         curr->next_->prev_ = curr->prev_;
       }
     }
+    // keep curr->next_, lock-free readers standing on curr go on from there
     curr->prev_ = NULL;
-    curr->next_ = NULL;
     ATOMIC_DEC(&total_cnt_);
   }
 
@@ -267,27 +313,8 @@ public:
       ret = OB_INVALID_ARGUMENT;
       TRANS_LOG(WARN, "invalid argument", K(key));
     } else {
-      Value *tmp_value = NULL;
       int64_t pos = key.hash() % BUCKETS_CNT;
-
-      BucketRLockGuard guard(buckets_[pos].lock_, get_itid());
-
-      tmp_value = buckets_[pos].next_;
-      while (OB_NOT_NULL(tmp_value)) {
-        if (tmp_value->contain(key)) {
-          value = tmp_value;
-          break;
-        } else {
-          tmp_value = tmp_value->next_;
-        }
-      }
-
-      if (OB_ISNULL(tmp_value)) {
-        ret = OB_ENTRY_NOT_EXIST;
-      } else {
-        // inc ref when get value
-        value->inc_ref(1);
-      }
+      ret = get_without_lock_(pos, key, value);
     }
     return ret;
   }
@@ -296,7 +323,11 @@ public:
   {
     if (OB_NOT_NULL(value)) {
       if (0 == value->dec_ref(1)) {
-        alloc_handle_.free_value(value);
+        // lock-free readers may still walk through the value, never wait
+        // for them here since the caller may hold locks
+        if (0 == retire_(value) % RECLAIM_BATCH_CNT) {
+          reclaim_(false);
+        }
       }
     }
   }
@@ -325,10 +356,7 @@ public:
           if (OB_SUCC(ret) && !fn(array.at(i))) {
             ret = OB_EAGAIN;
           }
-          if (0 == array.at(i)->dec_ref(1)) {
-            alloc_handle_.free_value(array.at(i));
-          }
-
+          revert(array.at(i));
         }
       }
     }
@@ -349,16 +377,13 @@ public:
         for (int64_t i = 0; i < cnt; ++i) {
           if (fn(array.at(i))) {
             BucketWLockGuard guard(buckets_[pos].lock_, get_itid());
-            if (buckets_[pos].next_ != array.at(i)
-                && (NULL == array.at(i)->prev_ && NULL == array.at(i)->next_)) {
+            if (buckets_[pos].next_ != array.at(i) && NULL == array.at(i)->prev_) {
               // do nothing
             } else {
               del_from_bucket_(pos, array.at(i));
             }
           }
-          if (0 == array.at(i)->dec_ref(1)) {
-            alloc_handle_.free_value(array.at(i));
-          }
+          revert(array.at(i));
         }
       }
     }
@@ -413,6 +438,107 @@ public:
   static int64_t get_buckets_cnt() {
     return BUCKETS_CNT;
   }
+
+  // retired values are reclaimed once per this many retires
+  static const int64_t RECLAIM_BATCH_CNT = 32;
+  // free all retired values, waits for the lock-free readers which may still
+  // walk through them, so never call it with a bucket lock held
+  void reclaim_retired() { reclaim_(true); }
+private:
+  int get_without_lock_(const int64_t pos, const Key &key, Value *&value)
+  {
+    int ret = OB_ENTRY_NOT_EXIST;
+    EpochGuard guard(*this);
+    Value *tmp_value = ATOMIC_LOAD(&buckets_[pos].next_);
+    while (OB_NOT_NULL(tmp_value)) {
+      // the value whose ref is zero is being freed, skip it
+      if (tmp_value->contain(key) && tmp_value->try_inc_ref()) {
+        value = tmp_value;
+        ret = OB_SUCCESS;
+        break;
+      } else {
+        tmp_value = ATOMIC_LOAD(&tmp_value->next_);
+      }
+    }
+    return ret;
+  }
+
+  // return the number of values retired so far
+  int64_t retire_(Value *value)
+  {
+    Value *old_head = NULL;
+    Value *head = ATOMIC_LOAD(&retire_list_);
+    do {
+      old_head = head;
+      value->retire_next_ = old_head;
+    } while (old_head != (head = ATOMIC_VCAS(&retire_list_, old_head, value)));
+    return ATOMIC_AAF(&retire_cnt_, 1);
+  }
+
+  // Values retired before an epoch flip are only reachable by readers which
+  // entered the qsync of an old epoch, free them once that qsync is drained.
+  // Readers of the new epoch never delay the reclaim.
+  void reclaim_(const bool need_wait)
+  {
+    bool locked = ATOMIC_BCAS(&reclaim_lock_, 0, 1);
+    while (need_wait && !locked) {
+      sched_yield();
+      locked = ATOMIC_BCAS(&reclaim_lock_, 0, 1);
+    }
+    if (locked) {
+      // the second round frees the values moved by the first one if the old
+      // epoch is already drained
+      for (int64_t round = 0; round < 2; ++round) {
+        if (NULL != reclaim_list_) {
+          common::ObQSync &old_qsync = qsync_[(ATOMIC_LOAD(&qsync_epoch_) - 1) & 1];
+          if (need_wait) {
+            WaitQuiescent(old_qsync);
+          }
+          if (need_wait || old_qsync.try_sync()) {
+            Value *curr = reclaim_list_;
+            ATOMIC_STORE(&reclaim_list_, NULL);
+            while (OB_NOT_NULL(curr)) {
+              Value *next = curr->retire_next_;
+              alloc_handle_.free_value(curr);
+              curr = next;
+            }
+          }
+        }
+        if (NULL == reclaim_list_ && NULL != ATOMIC_LOAD(&retire_list_)) {
+          ATOMIC_STORE(&reclaim_list_, ATOMIC_TAS(&retire_list_, (Value *)NULL));
+          ATOMIC_INC(&qsync_epoch_);
+        }
+      }
+      ATOMIC_STORE(&reclaim_lock_, 0);
+    }
+  }
+
+  // enter the qsync of the current epoch, retry if the epoch is flipped in
+  // between so that the reclaimer never misses a reader of the old epoch
+  class EpochGuard
+  {
+  public:
+    explicit EpochGuard(ObTransHashMap &map) : qsync_(NULL), ref_(0)
+    {
+      while (OB_ISNULL(qsync_)) {
+        const int64_t epoch = ATOMIC_LOAD(&map.qsync_epoch_);
+        common::ObQSync &qsync = map.qsync_[epoch & 1];
+        ref_ = qsync.acquire_ref();
+        if (epoch == ATOMIC_LOAD(&map.qsync_epoch_)) {
+          qsync_ = &qsync;
+        } else {
+          qsync.release_ref(ref_);
+        }
+      }
+    }
+    ~EpochGuard() { qsync_->release_ref(ref_); }
+  private:
+    common::ObQSync *qsync_;
+    int64_t ref_;
+  private:
+    DISALLOW_COPY_AND_ASSIGN(EpochGuard);
+  };
+
 private:
   struct ObTransHashHeader
   {
@@ -526,6 +652,16 @@ private:
   ObTransHashHeader buckets_[BUCKETS_CNT];
   int64_t total_cnt_;
   AllocHandle alloc_handle_;
+  // lock-free readers of each map enter qsync_[qsync_epoch_ & 1]
+  common::ObQSync qsync_[2];
+  int64_t qsync_epoch_ CACHE_ALIGNED;
+  // values whose ref dropped to zero and not yet bound to an epoch, kept off
+  // the line of qsync_epoch_ which every reader loads
+  Value *retire_list_ CACHE_ALIGNED;
+  int64_t retire_cnt_;
+  // values retired before the last epoch flip, wait for the old readers
+  Value *reclaim_list_;
+  int64_t reclaim_lock_;
 };
 
 }
@@ -447,6 +447,19 @@ int ObTransService::push(void *task)
   return ObSimpleThreadPool::push(task);
 }
 
+// Count the commit callbacks this thread pushed back without handling any.
+// Once the count exceeds the queue length, a whole pass over the queue found
+// nothing ready, so the thread sleeps instead of spinning on the waiting ones.
+RLOCAL(int64_t, requeue_without_progress_cnt);
+
+void ObTransService::backoff_if_no_progress_(const int64_t need_wait_us)
+{
+  if (++requeue_without_progress_cnt > get_queue_num()) {
+    ob_usleep(MIN(need_wait_us, ObTransTask::RETRY_SLEEP_TIME_US));
+    requeue_without_progress_cnt = 0;
+  }
+}
+
 void ObTransService::handle(void *task)
 {
   int ret = OB_SUCCESS;
@@ -458,28 +471,44 @@ void ObTransService::handle(void *task)
     TRANS_LOG(ERROR, "task is null", KP(task));
   } else {
     trans_task = static_cast<ObTransTask*>(task);
-    if (!trans_task->ready_to_handle()) {
-      if (OB_FAIL(push(trans_task))) {
-        TRANS_LOG(WARN, "transaction service push task error", KR(ret), K(*trans_task));
-        //TransRpcTaskFactory::release(static_cast<TransRpcTask*>(trans_task));
-      }
-    } else if (ObTransRetryTaskType::END_TRANS_CB_TASK == trans_task->get_task_type()) {
+    if (ObTransRetryTaskType::END_TRANS_CB_TASK == trans_task->get_task_type()) {
+      // the commit callback task checks gts elapsing by itself rather than by
+      // ready_to_handle, which sleeps on the shared thread for every pop
       bool has_cb = false;
       ObTxCommitCallbackTask *commit_cb_task = static_cast<ObTxCommitCallbackTask*>(task);
       int64_t need_wait_us = commit_cb_task->get_need_wait_us();
+      bool requeued = false;
       if (need_wait_us > 0) {
-        ob_usleep(need_wait_us);
+        backoff_if_no_progress_(need_wait_us);
+        if (OB_FAIL(push(commit_cb_task))) {
+          TRANS_LOG(WARN, "transaction service push task error", KR(ret), KPC(commit_cb_task));
+          ret = OB_SUCCESS;
+          ob_usleep(commit_cb_task->get_need_wait_us());
+        } else {
+          requeued = true;
+        }
       }
-      if (OB_FAIL(commit_cb_task->callback(has_cb))) {
+      if (requeued) {
+        // handled again by any thread, do not touch the task any more
+      } else if (OB_FAIL(commit_cb_task->callback(has_cb))) {
         TRANS_LOG(WARN, "end trans cb task callback error", KR(ret), KPC(commit_cb_task));
       }
-      if (has_cb) {
+      if (requeued) {
+        // do nothing
+      } else if (has_cb) {
+        requeue_without_progress_cnt = 0;
         ObTxCommitCallbackTaskFactory::release(commit_cb_task);
+      } else if (FALSE_IT(backoff_if_no_progress_(ObTransTask::RETRY_SLEEP_TIME_US))) {
       } else if (OB_FAIL(push(commit_cb_task))) {
         TRANS_LOG(WARN, "transaction service push task error", KR(ret), KPC(commit_cb_task));
       } else {
         // do nothing
       }
+    } else if (!trans_task->ready_to_handle()) {
+      if (OB_FAIL(push(trans_task))) {
+        TRANS_LOG(WARN, "transaction service push task error", KR(ret), K(*trans_task));
+        //TransRpcTaskFactory::release(static_cast<TransRpcTask*>(trans_task));
+      }
     } else if (ObTransRetryTaskType::ADVANCE_LS_CKPT_TASK == trans_task->get_task_type()) {
       ObAdvanceLSCkptTask *advance_ckpt_task = static_cast<ObAdvanceLSCkptTask *>(trans_task);
       if (OB_ISNULL(advance_ckpt_task)) {
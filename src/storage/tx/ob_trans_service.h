@@ -203,6 +203,7 @@ public:
 #endif
 private:
   void check_env_();
+  void backoff_if_no_progress_(const int64_t need_wait_us);
   bool can_create_ctx_(const int64_t trx_start_ts, const common::ObTsWindows &changing_leader_windows);
 private:
   int handle_redo_sync_task_(ObDupTableRedoSyncTask *task, bool &need_release_task);
@@ -26,11 +26,20 @@ namespace transaction
 {
 class ObPartTransCtx;
 
+// Early lock release(ELR) releases the row locks of a txn once its commit log
+// is submitted to clog, before the log is synchronized. It applies to both
+// one phase commit and the commit phase of two phase commit, since in both
+// cases the commit decision has been made and the commit version is known.
+//
+// NB: row locks can not be released in the prepare phase of two phase commit,
+// because the txn may still be aborted by other participants, and the txns
+// which have written the released rows would have to be aborted in cascade,
+// which needs the write dependency tracking that memtable does not have.
 enum TxELRState
 {
   //初始化状态
   ELR_INIT = 0,
-  //单分区和单机多分区事务，日志已经成功提交给clog，表示elr preparing
+  //commit日志已经成功提交给clog，表示elr preparing
   ELR_PREPARING = 1,
   //gts的时间戳已经推过global trans version
   ELR_PREPARED = 2
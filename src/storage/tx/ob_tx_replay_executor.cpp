@@ -557,9 +557,9 @@ int ObTxReplayExecutor::replay_one_row_in_memtable_(ObMutatorRowHeader &row_head
 {
   int ret = OB_SUCCESS;
   lib::Worker::CompatMode mode;
-  ObTabletHandle tablet_handle;
+  ObTabletHandle *tablet_handle = nullptr;
 
-  if (OB_FAIL(ls_->replay_get_tablet(row_head.tablet_id_, log_ts_ns_, tablet_handle))) {
+  if (OB_FAIL(get_replay_tablet_(row_head.tablet_id_, tablet_handle))) {
     if (OB_TABLET_NOT_EXIST == ret) {
       ctx_->force_no_need_replay_checksum();
       ret = OB_SUCCESS;
@@ -576,7 +576,7 @@ int ObTxReplayExecutor::replay_one_row_in_memtable_(ObMutatorRowHeader &row_head
   } else if (OB_FAIL(get_compat_mode_(row_head.tablet_id_, mode))) {
     TRANS_LOG(WARN, "[Replay Tx] get compat mode error", K(ret), K(mode));
   } else {
-    ObTablet *tablet = tablet_handle.get_obj();
+    ObTablet *tablet = tablet_handle->get_obj();
     storage::ObStoreCtx storeCtx;
     storeCtx.ls_id_ = ctx_->get_ls_id();
     storeCtx.mvcc_acc_ctx_.init_replay(
@@ -708,6 +708,29 @@ int ObTxReplayExecutor::replay_lock_(storage::ObStoreCtx &store_ctx,
   return ret;
 }
 
+int ObTxReplayExecutor::get_replay_tablet_(const ObTabletID &tablet_id,
+                                           ObTabletHandle *&tablet_handle)
+{
+  int ret = OB_SUCCESS;
+
+  if (tablet_id == replay_tablet_id_ && replay_tablet_handle_.is_valid()) {
+    // same tablet as the previous row of this log, reuse it
+  } else {
+    replay_tablet_id_.reset();
+    replay_tablet_handle_.reset();
+    if (OB_FAIL(ls_->replay_get_tablet(tablet_id, log_ts_ns_, replay_tablet_handle_))) {
+      replay_tablet_handle_.reset();
+    } else {
+      replay_tablet_id_ = tablet_id;
+    }
+  }
+  if (OB_SUCC(ret)) {
+    tablet_handle = &replay_tablet_handle_;
+  }
+
+  return ret;
+}
+
 int ObTxReplayExecutor::get_compat_mode_(const ObTabletID &tablet_id, lib::Worker::CompatMode &mode)
 {
   int ret = OB_SUCCESS;
@@ -18,6 +18,7 @@
 
 #include "lib/worker.h"
 #include "storage/ob_storage_table_guard.h"
+#include "storage/meta_mem/ob_tablet_handle.h"
 
 namespace oceanbase
 {
@@ -77,7 +78,8 @@ private:
                      const share::SCN &log_timestamp)
       : ctx_(nullptr), ls_(ls), ls_tx_srv_(ls_tx_srv), lsn_(lsn),
         log_ts_ns_(log_timestamp), mmi_ptr_(nullptr), mt_ctx_(nullptr), first_created_ctx_(false),
-        has_redo_(false), tx_part_log_no_(0), mvcc_row_count_(0), table_lock_row_count_(0)
+        has_redo_(false), tx_part_log_no_(0), mvcc_row_count_(0), table_lock_row_count_(0),
+        replay_tablet_id_(), replay_tablet_handle_()
   {}
 
   ~ObTxReplayExecutor() { ob_free(mmi_ptr_); }
@@ -120,6 +122,7 @@ private:
                    storage::ObTablet *tablet,
                    memtable::ObMemtableMutatorIterator *mmi_ptr,
                    memtable::ObEncryptRowBuf &row_buf);
+  int get_replay_tablet_(const ObTabletID &tablet_id, storage::ObTabletHandle *&tablet_handle);
   int get_compat_mode_(const ObTabletID &tablet_id, lib::Worker::CompatMode &mode);
   bool can_replay() const;
 
@@ -147,6 +150,10 @@ private:
   // memtable::ObMemtable * mem_store_;
   int64_t mvcc_row_count_;
   int64_t table_lock_row_count_;
+  // rows of one redo log are usually clustered by tablet, so the tablet
+  // looked up for the previous row is kept to skip the tablet map lookup
+  common::ObTabletID replay_tablet_id_;
+  storage::ObTabletHandle replay_tablet_handle_;
 };
 }
 } // namespace oceanbase
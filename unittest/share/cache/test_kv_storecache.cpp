@@ -11,6 +11,8 @@
  */
 
 #include <gtest/gtest.h>
+#include <thread>
+#include <vector>
 #define private public
 #define protected public
 #include "share/ob_thread_mgr.h"
@@ -21,6 +23,7 @@
 #include "observer/ob_signal_handle.h"
 #include "ob_cache_test_utils.h"
 #include "share/ob_tenant_mgr.h"
+#include "lib/cpu/ob_cpu_topology.h"
 
 namespace oceanbase
 {
@@ -174,6 +177,34 @@ TEST(ObKVGlobalCache, normal)
   ObKVGlobalCache::get_instance().destroy();
 }
 
+TEST(ObKVCacheFrequencySketch, normal)
+{
+  ObKVCacheFrequencySketch sketch;
+  ASSERT_EQ(0, sketch.estimate(1));
+  ASSERT_EQ(OB_INVALID_ARGUMENT, sketch.init(0));
+  ASSERT_EQ(OB_SUCCESS, sketch.init(1024));
+  ASSERT_EQ(OB_INIT_TWICE, sketch.init(1024));
+
+  // counters saturate at 15
+  for (int64_t i = 0; i < 20; ++i) {
+    sketch.increment(12345);
+  }
+  ASSERT_EQ(15, sketch.estimate(12345));
+  sketch.increment(67890);
+  ASSERT_LE(1, sketch.estimate(67890));
+  ASSERT_GE(15, sketch.estimate(67890));
+
+  // one-shot keys age out hot keys after sample size increments, which are
+  // published in batches per thread
+  const int64_t add_cnt = sketch.sample_size_ + ObKVCacheFrequencySketch::ADD_CNT_BATCH;
+  for (uint64_t i = 0; i < static_cast<uint64_t>(add_cnt); ++i) {
+    sketch.increment(i * 7919 + 100000);
+  }
+  ASSERT_GT(15, sketch.estimate(12345));
+  sketch.destroy();
+  ASSERT_EQ(0, sketch.estimate(12345));
+}
+
 /*
 TEST(TestKVCacheValue, wash_stress)
 {
@@ -433,6 +464,54 @@ TEST_F(TestKVCache, test_large_kv)
   }
 }
 
+TEST_F(TestKVCache, hot_key_get_contention)
+{
+  static const int64_t K_SIZE = 16;
+  static const int64_t V_SIZE = 64;
+  static const int64_t GET_PER_THREAD = 200000;
+  typedef TestKVCacheKey<K_SIZE> TestKey;
+  typedef TestKVCacheValue<V_SIZE> TestValue;
+
+  int ret = OB_SUCCESS;
+  ObKVCache<TestKey, TestValue> cache;
+  TestKey key;
+  TestValue value;
+  key.v_ = 4321;
+  key.tenant_id_ = tenant_id_;
+  value.v_ = 1234;
+
+  ret = cache.init("test");
+  ASSERT_EQ(OB_SUCCESS, ret);
+  ret = cache.put(key, value);
+  ASSERT_EQ(OB_SUCCESS, ret);
+
+  // every thread keeps hitting the same key
+  const int64_t max_thread_cnt = std::min(get_cpu_count() * 2, 64L);
+  for (int64_t thread_cnt = 1; thread_cnt <= max_thread_cnt; thread_cnt *= 2) {
+    int64_t fail_cnt = 0;
+    std::vector<std::thread> threads;
+    const int64_t start_ts = ObTimeUtility::current_time();
+    for (int64_t i = 0; i < thread_cnt; ++i) {
+      threads.emplace_back([&]() {
+        const TestValue *pvalue = NULL;
+        for (int64_t j = 0; j < GET_PER_THREAD; ++j) {
+          ObKVCacheHandle handle;
+          if (OB_SUCCESS != cache.get(key, pvalue, handle) || value.v_ != pvalue->v_) {
+            ATOMIC_INC(&fail_cnt);
+          }
+        }
+      });
+    }
+    for (auto &th : threads) {
+      th.join();
+    }
+    const int64_t cost_us = ObTimeUtility::current_time() - start_ts;
+    ASSERT_EQ(0, fail_cnt);
+    COMMON_LOG(INFO, "hot key get", K(thread_cnt), K(cost_us),
+               "get_per_us", thread_cnt * GET_PER_THREAD / max(cost_us, 1L));
+  }
+}
+
 // TEST_F(TestKVCache, test_reuse_wash_struct)
 // {
 //   TG_CANCEL(lib::TGDefIDs::KVCacheWash, ObKVGlobalCache::get_instance().wash_task_);
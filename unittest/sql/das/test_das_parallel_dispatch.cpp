@@ -0,0 +1,291 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL_DAS
+
+#include "gtest/gtest.h"
+#include <thread>
+#define private public
+#define protected public
+#include "sql/engine/ob_exec_context.h"
+#include "sql/session/ob_sql_session_info.h"
+#include "sql/das/ob_data_access_service.h"
+#include "sql/das/ob_das_scan_op.h"
+#include "sql/das/ob_das_ref.h"
+#include "storage/tx/ob_trans_service.h"
+#undef private
+#undef protected
+
+using namespace oceanbase::common;
+using namespace oceanbase::share;
+using namespace oceanbase::sql;
+using namespace oceanbase::transaction;
+
+class TestDASParallelDispatch : public ::testing::Test
+{
+public:
+  TestDASParallelDispatch()
+    : loc_meta_(allocator_),
+      exec_ctx_(allocator_),
+      eval_ctx_(exec_ctx_)
+  { }
+  virtual ~TestDASParallelDispatch() = default;
+  virtual void SetUp() override;
+  virtual void TearDown() override;
+  ObDASScanOp *make_task(const ObAddr &svr);
+  ObAddr svr(const int32_t port) { return ObAddr(ObAddr::IPV4, "127.0.0.1", port); }
+public:
+  ObArenaAllocator allocator_;
+  ObDASTableLocMeta loc_meta_;
+  ObExecContext exec_ctx_;
+  ObEvalCtx eval_ctx_;
+  ObSQLSessionInfo session_;
+  ObThreadCond cond_;
+  ObDataAccessService das_;
+};
+
+void TestDASParallelDispatch::SetUp()
+{
+  // a user table, so the partition level retry is not skipped as virtual table
+  loc_meta_.ref_table_id_ = 500001;
+  ASSERT_EQ(OB_SUCCESS, session_.test_init(0, 0, 0, &allocator_));
+  exec_ctx_.set_my_session(&session_);
+  ASSERT_EQ(OB_SUCCESS, cond_.init(ObWaitEventIds::DEFAULT_COND_WAIT));
+}
+
+void TestDASParallelDispatch::TearDown()
+{
+  cond_.destroy();
+}
+
+ObDASScanOp *TestDASParallelDispatch::make_task(const ObAddr &svr)
+{
+  ObDASScanOp *task_op = OB_NEWx(ObDASScanOp, &allocator_, allocator_);
+  ObDASTabletLoc *tablet_loc = OB_NEWx(ObDASTabletLoc, &allocator_);
+  if (OB_NOT_NULL(task_op) && OB_NOT_NULL(tablet_loc)) {
+    tablet_loc->server_ = svr;
+    tablet_loc->loc_meta_ = &loc_meta_;
+    tablet_loc->ls_id_ = ObLSID(1001);
+    task_op->set_tablet_loc(tablet_loc);
+    task_op->set_ls_id(tablet_loc->ls_id_);
+  }
+  return task_op;
+}
+
+TEST_F(TestDASParallelDispatch, split_mixed_local_remote)
+{
+  const ObAddr local = svr(1000);
+  const ObAddr b = svr(1001);
+  const ObAddr c = svr(1002);
+  const ObAddr old = svr(1003);
+  ObSEArray<ObAddr, 4> sync_svrs;
+  ObSEArray<ObIDASTaskOp*, 8> pending;
+  ObSEArray<ObIDASTaskOp*, 8> sync_tasks;
+  ObSEArray<ObIDASTaskOp*, 8> async_tasks;
+  ObSEArray<ObIDASTaskOp*, 8> next_tasks;
+  ASSERT_EQ(OB_SUCCESS, sync_svrs.push_back(old));
+  ObIDASTaskOp *t0 = make_task(local);
+  ObIDASTaskOp *t1 = make_task(b);
+  ObIDASTaskOp *t2 = make_task(c);
+  ObIDASTaskOp *t3 = make_task(b);
+  ObIDASTaskOp *t4 = make_task(local);
+  ObIDASTaskOp *t5 = make_task(old);
+  ObIDASTaskOp *t6 = make_task(b);
+  ASSERT_EQ(OB_SUCCESS, pending.push_back(t0));
+  ASSERT_EQ(OB_SUCCESS, pending.push_back(t1));
+  ASSERT_EQ(OB_SUCCESS, pending.push_back(t2));
+  ASSERT_EQ(OB_SUCCESS, pending.push_back(t3));
+  ASSERT_EQ(OB_SUCCESS, pending.push_back(t4));
+  ASSERT_EQ(OB_SUCCESS, pending.push_back(t5));
+  ASSERT_EQ(OB_SUCCESS, pending.push_back(t6));
+
+  // local tasks and tasks of servers without the async rpc run on this thread,
+  // every other server gets one task per wave in the original order
+  ASSERT_EQ(OB_SUCCESS, ObDataAccessService::split_das_task_wave(
+      local, sync_svrs, pending, sync_tasks, async_tasks, next_tasks));
+  ASSERT_EQ(3, sync_tasks.count());
+  EXPECT_EQ(t0, sync_tasks.at(0));
+  EXPECT_EQ(t4, sync_tasks.at(1));
+  EXPECT_EQ(t5, sync_tasks.at(2));
+  ASSERT_EQ(2, async_tasks.count());
+  EXPECT_EQ(t1, async_tasks.at(0));
+  EXPECT_EQ(t2, async_tasks.at(1));
+  ASSERT_EQ(2, next_tasks.count());
+  EXPECT_EQ(t3, next_tasks.at(0));
+  EXPECT_EQ(t6, next_tasks.at(1));
+
+  ASSERT_EQ(OB_SUCCESS, pending.assign(next_tasks));
+  ASSERT_EQ(OB_SUCCESS, ObDataAccessService::split_das_task_wave(
+      local, sync_svrs, pending, sync_tasks, async_tasks, next_tasks));
+  EXPECT_EQ(0, sync_tasks.count());
+  ASSERT_EQ(1, async_tasks.count());
+  EXPECT_EQ(t3, async_tasks.at(0));
+  ASSERT_EQ(1, next_tasks.count());
+  EXPECT_EQ(t6, next_tasks.at(0));
+
+  // once b rejected the async rpc, its remaining task runs synchronously
+  ASSERT_EQ(OB_SUCCESS, sync_svrs.push_back(b));
+  ASSERT_EQ(OB_SUCCESS, pending.assign(next_tasks));
+  ASSERT_EQ(OB_SUCCESS, ObDataAccessService::split_das_task_wave(
+      local, sync_svrs, pending, sync_tasks, async_tasks, next_tasks));
+  ASSERT_EQ(1, sync_tasks.count());
+  EXPECT_EQ(t6, sync_tasks.at(0));
+  EXPECT_EQ(0, async_tasks.count());
+  EXPECT_EQ(0, next_tasks.count());
+}
+
+TEST_F(TestDASParallelDispatch, async_cb_finish)
+{
+  ObIDASTaskOp *task_op = make_task(svr(1001));
+  ObDASAsyncAccessCB timeout_cb(cond_, *task_op);
+  ObDASAsyncAccessCB error_cb(cond_, *task_op);
+  ObDASAsyncAccessCB invalid_cb(cond_, *task_op);
+  ObDASAsyncAccessCB send_fail_cb(cond_, *task_op);
+  ObDASAsyncAccessCB old_runner_cb(cond_, *task_op);
+  ObDASAsyncAccessCB resp_cb(cond_, *task_op);
+  EXPECT_FALSE(timeout_cb.is_done());
+
+  timeout_cb.on_timeout();
+  EXPECT_TRUE(timeout_cb.is_done());
+  EXPECT_EQ(OB_TIMEOUT, timeout_cb.get_rpc_ret());
+
+  EXPECT_EQ(OB_SUCCESS, error_cb.on_error(OB_RPC_CONNECT_ERROR));
+  EXPECT_TRUE(error_cb.is_done());
+  EXPECT_EQ(OB_RPC_SEND_ERROR, error_cb.get_rpc_ret());
+
+  invalid_cb.on_invalid();
+  EXPECT_TRUE(invalid_cb.is_done());
+  EXPECT_EQ(OB_RPC_PACKET_INVALID, invalid_cb.get_rpc_ret());
+
+  // a failed send is finished by the controller itself
+  send_fail_cb.finish(OB_RPC_SEND_ERROR);
+  EXPECT_TRUE(send_fail_cb.is_done());
+  EXPECT_EQ(OB_RPC_SEND_ERROR, send_fail_cb.get_rpc_ret());
+
+  // an older runner answers the unknown pcode with OB_NOT_SUPPORTED
+  old_runner_cb.rcode_.rcode_ = OB_NOT_SUPPORTED;
+  EXPECT_EQ(OB_SUCCESS, old_runner_cb.process());
+  EXPECT_TRUE(old_runner_cb.is_done());
+  EXPECT_EQ(OB_NOT_SUPPORTED, old_runner_cb.get_rpc_ret());
+
+  // the error of the task itself is carried by the response, not the rpc
+  resp_cb.get_task_resp().set_err_code(OB_NOT_MASTER);
+  EXPECT_EQ(OB_SUCCESS, resp_cb.process());
+  EXPECT_TRUE(resp_cb.is_done());
+  EXPECT_EQ(OB_SUCCESS, resp_cb.get_rpc_ret());
+}
+
+TEST_F(TestDASParallelDispatch, wait_all_callbacks)
+{
+  ObIDASTaskOp *task_op = make_task(svr(1001));
+  ObDASAsyncAccessCB cb1(cond_, *task_op);
+  ObDASAsyncAccessCB cb2(cond_, *task_op);
+  ObSEArray<ObDASAsyncAccessCB*, 2> cbs;
+  ASSERT_EQ(OB_SUCCESS, cbs.push_back(&cb1));
+  ASSERT_EQ(OB_SUCCESS, cbs.push_back(&cb2));
+  std::thread rpc_thread([&]() {
+    ::usleep(50 * 1000);
+    cb1.process();
+    ::usleep(50 * 1000);
+    cb2.on_timeout();
+  });
+  const int64_t start = ObTimeUtility::current_time();
+  ObDataAccessService::wait_async_das_task(cond_, cbs);
+  const int64_t elapsed = ObTimeUtility::current_time() - start;
+  rpc_thread.join();
+  EXPECT_TRUE(cb1.is_done());
+  EXPECT_TRUE(cb2.is_done());
+  EXPECT_GE(elapsed, 100 * 1000);
+  EXPECT_EQ(OB_SUCCESS, cb1.get_rpc_ret());
+  EXPECT_EQ(OB_TIMEOUT, cb2.get_rpc_ret());
+}
+
+TEST_F(TestDASParallelDispatch, async_failure_retry)
+{
+  ObDASRef das_ref(eval_ctx_, exec_ctx_);
+  ObIDASTaskOp *task_op = make_task(svr(1001));
+  ObDASAsyncAccessCB cb(cond_, *task_op);
+  cb.on_timeout();
+
+  // a timeout is not a location error, the partition level retry gives it back
+  task_op->set_can_part_retry(true);
+  EXPECT_EQ(OB_TIMEOUT, das_.process_async_das_resp(das_ref, cb));
+  EXPECT_EQ(OB_TIMEOUT, task_op->errcode_);
+  // the participant may be touched by the lost request
+  EXPECT_TRUE(has_exist_in_array(session_.get_trans_result().get_touched_ls(),
+                                 task_op->get_ls_id()));
+
+  // a location error of a task which can not be retried is returned as is
+  ObDASAsyncAccessCB send_fail_cb(cond_, *task_op);
+  send_fail_cb.finish(OB_NOT_MASTER);
+  task_op->set_can_part_retry(false);
+  EXPECT_EQ(OB_NOT_MASTER, das_.process_async_das_resp(das_ref, send_fail_cb));
+  EXPECT_EQ(OB_NOT_MASTER, task_op->errcode_);
+}
+
+TEST_F(TestDASParallelDispatch, wave_failure_keeps_trans_result)
+{
+  // add_tx_exec_result only touches the tx desc, the service is not set up
+  ObTransService *txs =
+      (ObTransService*)ob_malloc(sizeof(ObTransService));
+  ObTenantBase tenant_base(1);
+  tenant_base.set(txs);
+  ObTenantEnv::set_tenant(&tenant_base);
+  ObTxDesc tx_desc;
+  session_.get_tx_desc() = &tx_desc;
+  ObDASRef das_ref(eval_ctx_, exec_ctx_);
+  ObSEArray<ObAddr, 4> sync_svrs;
+  ObSEArray<ObDASAsyncAccessCB*, 4> cbs;
+  ObIDASTaskOp *fail_task = make_task(svr(1001));
+  ObIDASTaskOp *succ_task = make_task(svr(1002));
+  ObIDASTaskOp *lost_task = make_task(svr(1003));
+  succ_task->set_ls_id(ObLSID(1002));
+  lost_task->set_ls_id(ObLSID(1003));
+  ObDASAsyncAccessCB *fail_cb = OB_NEWx(ObDASAsyncAccessCB, &allocator_, cond_, *fail_task);
+  ObDASAsyncAccessCB *succ_cb = OB_NEWx(ObDASAsyncAccessCB, &allocator_, cond_, *succ_task);
+  ObDASAsyncAccessCB *lost_cb = OB_NEWx(ObDASAsyncAccessCB, &allocator_, cond_, *lost_task);
+  ASSERT_TRUE(OB_NOT_NULL(fail_cb) && OB_NOT_NULL(succ_cb) && OB_NOT_NULL(lost_cb));
+  ASSERT_EQ(OB_SUCCESS, cbs.push_back(fail_cb));
+  ASSERT_EQ(OB_SUCCESS, cbs.push_back(succ_cb));
+  ASSERT_EQ(OB_SUCCESS, cbs.push_back(lost_cb));
+
+  // the first task of the wave fails, its siblings already finished remotely:
+  // one executed and touched ls 1002, the rpc of the other one was lost
+  fail_task->set_can_part_retry(false);
+  fail_cb->finish(OB_TIMEOUT);
+  ObTxPart part;
+  part.id_ = ObLSID(1002);
+  part.addr_ = svr(1002);
+  ASSERT_EQ(OB_SUCCESS, succ_cb->get_task_resp().get_trans_result().parts_.push_back(part));
+  succ_cb->rcode_.rcode_ = OB_SUCCESS;
+  ASSERT_EQ(OB_SUCCESS, succ_cb->process());
+  lost_cb->on_timeout();
+
+  EXPECT_EQ(OB_TIMEOUT, das_.process_async_das_resps(das_ref, cbs, sync_svrs, OB_SUCCESS));
+  ASSERT_EQ(1, tx_desc.parts_.count());
+  EXPECT_EQ(ObLSID(1002), tx_desc.parts_.at(0).id_);
+  EXPECT_TRUE(has_exist_in_array(session_.get_trans_result().get_touched_ls(), ObLSID(1003)));
+  EXPECT_EQ(0, sync_svrs.count());
+
+  session_.get_tx_desc() = NULL;
+  ObTenantEnv::set_tenant(nullptr);
+  ob_free(txs);
+}
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_das_parallel_dispatch.log*");
+  OB_LOGGER.set_file_name("test_das_parallel_dispatch.log", true, false);
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,174 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL
+
+#include <gtest/gtest.h>
+#define private public
+#define protected public
+#include "sql/engine/px/ob_px_scheduler.h"
+#include "sql/engine/px/ob_dfo_scheduler.h"
+#include "sql/engine/px/ob_px_coord_op.h"
+#include "sql/engine/ob_physical_plan.h"
+#include "sql/engine/ob_physical_plan_ctx.h"
+#include "sql/engine/ob_exec_context.h"
+#include "sql/session/ob_sql_session_info.h"
+#undef private
+#undef protected
+
+using namespace oceanbase::common;
+using namespace oceanbase::sql;
+
+namespace test
+{
+
+class MockListener : public ObIPxCoordEventListener
+{
+public:
+  virtual int on_root_data_channel_setup() override { return OB_SUCCESS; }
+};
+
+class MockRootDfoAction : public ObPxRootDfoAction
+{
+public:
+  virtual int receive_channel_root_dfo(ObExecContext &, ObDfo &, ObPxTaskChSets &) override
+  { return OB_SUCCESS; }
+  virtual int receive_channel_root_dfo(ObExecContext &, ObDfo &, dtl::ObDtlChTotalInfo &) override
+  { return OB_SUCCESS; }
+  virtual int notify_peers_mock_eof(ObDfo *, int64_t, ObAddr) const override
+  { return OB_SUCCESS; }
+};
+
+class MockScheduler : public ObDfoSchedulerBasic
+{
+public:
+  MockScheduler(ObPxCoordInfo &coord_info,
+                ObPxRootDfoAction &root_dfo_action,
+                ObIPxCoordEventListener &listener)
+    : ObDfoSchedulerBasic(coord_info, root_dfo_action, listener) {}
+  virtual int dispatch_dtl_data_channel_info(ObExecContext &, ObDfo &, ObDfo &) const override
+  { return OB_SUCCESS; }
+  // the dfo under test is the last one
+  virtual int try_schedule_next_dfo(ObExecContext &) const override { return OB_ITER_END; }
+};
+
+class TestPxCardFeedback : public ::testing::Test
+{
+public:
+  static const int64_t EST_ROWS = 1000;
+  TestPxCardFeedback()
+    : exec_ctx_(allocator_),
+      root_spec_(allocator_, PHY_SORT),
+      // the finish message path never touches the coord op
+      coord_info_(*reinterpret_cast<ObPxCoordOp *>(coord_buf_), allocator_, msg_loop_, interrupt_id_),
+      msg_proc_(coord_info_, listener_, root_dfo_action_),
+      scheduler_(coord_info_, root_dfo_action_, listener_),
+      dfo_(allocator_)
+  {}
+  virtual void SetUp() override;
+  int finish_sqc(const int64_t sqc_id, const int64_t actual_rows);
+public:
+  ObArenaAllocator allocator_;
+  ObSQLSessionInfo session_;
+  ObExecContext exec_ctx_;
+  ObPhysicalPlan plan_;
+  ObOpSpec root_spec_;
+  char coord_buf_[sizeof(ObPxCoordOp)];
+  dtl::ObDtlChannelLoop msg_loop_;
+  ObInterruptibleTaskID interrupt_id_;
+  MockListener listener_;
+  MockRootDfoAction root_dfo_action_;
+  ObPxCoordInfo coord_info_;
+  ObPxMsgProc msg_proc_;
+  MockScheduler scheduler_;
+  ObDfo dfo_;
+};
+
+void TestPxCardFeedback::SetUp()
+{
+  ASSERT_EQ(OB_SUCCESS, session_.test_init(0, 0, 0, &allocator_));
+  exec_ctx_.set_my_session(&session_);
+  ASSERT_EQ(OB_SUCCESS, exec_ctx_.create_physical_plan_ctx());
+  // cached long enough to be expired by cardinality feedback
+  plan_.stat_.gen_time_ = ObTimeUtility::current_time()
+                          - ObPhysicalPlan::CARD_FEEDBACK_MIN_PLAN_AGE - 1;
+  root_spec_.plan_ = &plan_;
+  dfo_.set_dfo_id(0);
+  dfo_.set_root_op_spec(&root_spec_);
+  ASSERT_EQ(OB_SUCCESS, coord_info_.dfo_mgr_.add_dfo_edge(&dfo_));
+  msg_proc_.set_scheduler(&scheduler_);
+}
+
+int TestPxCardFeedback::finish_sqc(const int64_t sqc_id, const int64_t actual_rows)
+{
+  int ret = OB_SUCCESS;
+  ObPxFinishSqcResultMsg pkt;
+  pkt.dfo_id_ = dfo_.get_dfo_id();
+  pkt.sqc_id_ = sqc_id;
+  pkt.rc_ = OB_SUCCESS;
+  if (OB_FAIL(pkt.card_feedback_info_.add_card_feedback(1, EST_ROWS, actual_rows))) {
+    LOG_WARN("add card feedback failed", K(ret));
+  } else if (OB_FAIL(msg_proc_.on_sqc_finish_msg(exec_ctx_, pkt))) {
+    LOG_WARN("process sqc finish msg failed", K(ret));
+  }
+  return ret;
+}
+
+TEST_F(TestPxCardFeedback, single_sqc_dfo)
+{
+  ObPxSqcMeta sqc;
+  sqc.set_sqc_id(0);
+  ASSERT_EQ(OB_SUCCESS, dfo_.add_sqc(sqc));
+  // the rows of the only sqc are checked once the dfo finishes
+  ASSERT_EQ(OB_SUCCESS, finish_sqc(0, EST_ROWS * 10000));
+  EXPECT_TRUE(dfo_.is_thread_finish());
+  EXPECT_TRUE(plan_.is_expired());
+}
+
+TEST_F(TestPxCardFeedback, rows_summed_over_sqcs)
+{
+  const int64_t sqc_rows = ObPhysicalPlan::CARD_MISESTIMATE_ROW_THRESHOLD / 2 + 1;
+  for (int64_t i = 0; i < 2; ++i) {
+    ObPxSqcMeta sqc;
+    sqc.set_sqc_id(i);
+    ASSERT_EQ(OB_SUCCESS, dfo_.add_sqc(sqc));
+  }
+  ASSERT_EQ(OB_SUCCESS, finish_sqc(0, sqc_rows));
+  EXPECT_FALSE(dfo_.is_thread_finish());
+  EXPECT_FALSE(plan_.is_expired());
+  // neither sqc alone is above the threshold, the whole dfo is
+  ASSERT_EQ(OB_SUCCESS, finish_sqc(1, sqc_rows));
+  EXPECT_TRUE(dfo_.is_thread_finish());
+  EXPECT_EQ(sqc_rows * 2, dfo_.get_card_feedback_info().feedbacks_.at(0).actual_rows_);
+  EXPECT_TRUE(plan_.is_expired());
+}
+
+TEST_F(TestPxCardFeedback, good_estimation_keeps_plan)
+{
+  ObPxSqcMeta sqc;
+  sqc.set_sqc_id(0);
+  ASSERT_EQ(OB_SUCCESS, dfo_.add_sqc(sqc));
+  ASSERT_EQ(OB_SUCCESS, finish_sqc(0, EST_ROWS));
+  EXPECT_TRUE(dfo_.is_thread_finish());
+  EXPECT_FALSE(plan_.is_expired());
+}
+
+} // end namespace test
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_px_card_feedback.log*");
+  OB_LOGGER.set_file_name("test_px_card_feedback.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
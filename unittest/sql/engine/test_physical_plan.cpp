@@ -13,6 +13,7 @@
 #include <gtest/gtest.h>
 #include "share/ob_define.h"
 #include "sql/engine/ob_physical_plan.h"
+#include "sql/engine/px/ob_px_dtl_msg.h"
 using namespace oceanbase::common;
 using namespace oceanbase::share::schema;
 namespace oceanbase
@@ -42,6 +43,63 @@ TEST_F(TestPhysicalPlan,  test_get_view_table)
   }
   EXPECT_EQ(VIEW_COUNT, plan.get_dependency_table_size());
 }
+
+TEST_F(TestPhysicalPlan, test_card_misestimate)
+{
+  ObPhysicalPlan plan;
+  const int64_t est_rows = 1000;
+  // cached long enough to be expired by cardinality feedback
+  plan.stat_.gen_time_ = ObTimeUtility::current_time()
+                         - ObPhysicalPlan::CARD_FEEDBACK_MIN_PLAN_AGE - 1;
+
+  // the right side of a nested loop join produces est_rows on each of its
+  // 10000 scans, the accumulated rows are not a misestimate
+  plan.check_card_misestimate(1, est_rows, est_rows * 10000, 10000);
+  EXPECT_FALSE(plan.is_expired());
+
+  // rows below the threshold never expire the plan
+  plan.check_card_misestimate(1, 1, ObPhysicalPlan::CARD_MISESTIMATE_ROW_THRESHOLD, 1);
+  EXPECT_FALSE(plan.is_expired());
+
+  // a fresh plan is kept even if the estimation is wrong
+  plan.stat_.gen_time_ = ObTimeUtility::current_time();
+  plan.check_card_misestimate(1, est_rows, est_rows * 10000, 1);
+  EXPECT_FALSE(plan.is_expired());
+
+  // a single scan produces far more rows than estimated
+  plan.stat_.gen_time_ = ObTimeUtility::current_time()
+                         - ObPhysicalPlan::CARD_FEEDBACK_MIN_PLAN_AGE - 1;
+  plan.check_card_misestimate(1, est_rows, est_rows * 10000, 1);
+  EXPECT_TRUE(plan.is_expired());
+}
+
+TEST_F(TestPhysicalPlan, test_px_card_feedback)
+{
+  ObPhysicalPlan plan;
+  const int64_t est_rows = 1000;
+  const int64_t worker_rows = ObPhysicalPlan::CARD_MISESTIMATE_ROW_THRESHOLD / 2;
+  plan.stat_.gen_time_ = ObTimeUtility::current_time()
+                         - ObPhysicalPlan::CARD_FEEDBACK_MIN_PLAN_AGE - 1;
+
+  // each worker alone is below the threshold, the whole dfo is not
+  ObPxCardFeedbackInfo sqc_info;
+  ObPxCardFeedbackInfo dfo_info;
+  for (int64_t i = 0; i < 4; ++i) {
+    ObPxCardFeedbackInfo task_info;
+    EXPECT_EQ(OB_SUCCESS, task_info.add_card_feedback(1, est_rows, worker_rows));
+    plan.check_card_misestimate(1, est_rows, worker_rows, 1);
+    EXPECT_FALSE(plan.is_expired());
+    EXPECT_EQ(OB_SUCCESS, sqc_info.add_card_feedback_info(task_info));
+  }
+  EXPECT_EQ(OB_SUCCESS, dfo_info.add_card_feedback_info(sqc_info));
+  ASSERT_EQ(1, dfo_info.feedbacks_.count());
+  EXPECT_EQ(worker_rows * 4, dfo_info.feedbacks_.at(0).actual_rows_);
+  plan.check_card_misestimate(dfo_info.feedbacks_.at(0).op_id_,
+                              dfo_info.feedbacks_.at(0).est_rows_,
+                              dfo_info.feedbacks_.at(0).actual_rows_,
+                              1);
+  EXPECT_TRUE(plan.is_expired());
+}
 } //namespace sql
 } //namespace oceanbase
 
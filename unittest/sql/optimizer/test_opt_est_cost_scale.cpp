@@ -0,0 +1,106 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#define private public
+#define protected public
+#include "sql/optimizer/ob_opt_est_cost.h"
+#include "sql/optimizer/ob_opt_est_parameter_normal.h"
+#include "sql/optimizer/ob_opt_est_parameter_vector.h"
+#undef private
+#undef protected
+
+using namespace oceanbase::sql;
+using namespace oceanbase::common;
+
+namespace test
+{
+
+class TestOptEstCostScale : public ::testing::Test
+{
+public:
+  virtual void TearDown() override
+  {
+    ObOptEstCost::set_cost_scale(1.0, 1.0, 1.0);
+  }
+  static const ObOptEstCostModel &model(const ObOptEstCost::MODEL_TYPE type)
+  {
+    return ObOptEstCost::get_model(type);
+  }
+};
+
+TEST_F(TestOptEstCostScale, scale_params)
+{
+  ObOptEstCost::set_cost_scale(2.0, 3.0, 4.0);
+  const ObOptEstCostModel::ObCostParams &normal = model(ObOptEstCost::NORMAL_MODEL).cost_params_;
+  const ObOptEstCostModel::ObCostParams &vector = model(ObOptEstCost::VECTOR_MODEL).cost_params_;
+  // cpu costs
+  EXPECT_DOUBLE_EQ(cost_params_normal.CPU_TUPLE_COST * 2, normal.CPU_TUPLE_COST);
+  EXPECT_DOUBLE_EQ(cost_params_normal.CMP_INT_COST * 2, normal.CMP_INT_COST);
+  EXPECT_DOUBLE_EQ(cost_params_normal.BUILD_HASH_PER_ROW_COST * 2, normal.BUILD_HASH_PER_ROW_COST);
+  EXPECT_DOUBLE_EQ(cost_params_vector.CPU_TUPLE_COST * 2, vector.CPU_TUPLE_COST);
+  EXPECT_DOUBLE_EQ(comparison_params_normal[ObIntTC] * 2,
+                   model(ObOptEstCost::NORMAL_MODEL).comparison_params_[ObIntTC]);
+  EXPECT_DOUBLE_EQ(hash_params_vector[ObIntTC] * 2,
+                   model(ObOptEstCost::VECTOR_MODEL).hash_params_[ObIntTC]);
+  // sequential and random io costs
+  EXPECT_DOUBLE_EQ(cost_params_normal.MICRO_BLOCK_SEQ_COST * 3, normal.MICRO_BLOCK_SEQ_COST);
+  EXPECT_DOUBLE_EQ(cost_params_vector.MICRO_BLOCK_SEQ_COST * 3, vector.MICRO_BLOCK_SEQ_COST);
+  EXPECT_DOUBLE_EQ(cost_params_normal.MICRO_BLOCK_RND_COST * 4, normal.MICRO_BLOCK_RND_COST);
+  EXPECT_DOUBLE_EQ(cost_params_normal.FETCH_ROW_RND_COST * 4, normal.FETCH_ROW_RND_COST);
+  EXPECT_DOUBLE_EQ(cost_params_normal.NL_GET_COST * 4, normal.NL_GET_COST);
+  // network and dml costs are not hardware scaled
+  EXPECT_EQ(cost_params_normal.NETWORK_TRANS_PER_BYTE_COST, normal.NETWORK_TRANS_PER_BYTE_COST);
+  EXPECT_EQ(cost_params_normal.INSERT_PER_ROW_COST, normal.INSERT_PER_ROW_COST);
+}
+
+TEST_F(TestOptEstCostScale, default_scale_keeps_params)
+{
+  ObOptEstCost::set_cost_scale(0.5, 0.25, 8.0);
+  ObOptEstCost::set_cost_scale(1.0, 1.0, 1.0);
+  const ObOptEstCostModel &normal = model(ObOptEstCost::NORMAL_MODEL);
+  const ObOptEstCostModel &vector = model(ObOptEstCost::VECTOR_MODEL);
+  EXPECT_EQ(0, MEMCMP(&cost_params_normal, &normal.cost_params_, sizeof(cost_params_normal)));
+  EXPECT_EQ(0, MEMCMP(&cost_params_vector, &vector.cost_params_, sizeof(cost_params_vector)));
+  EXPECT_EQ(0, MEMCMP(comparison_params_normal, normal.comparison_params_,
+                      sizeof(comparison_params_normal)));
+  EXPECT_EQ(0, MEMCMP(hash_params_normal, normal.hash_params_, sizeof(hash_params_normal)));
+  EXPECT_EQ(0, MEMCMP(comparison_params_vector, vector.comparison_params_,
+                      sizeof(comparison_params_vector)));
+  EXPECT_EQ(0, MEMCMP(hash_params_vector, vector.hash_params_, sizeof(hash_params_vector)));
+}
+
+TEST_F(TestOptEstCostScale, published_model_is_not_rewritten)
+{
+  // a model taken before a change keeps the params it was taken with
+  const ObOptEstCostModel &before = model(ObOptEstCost::NORMAL_MODEL);
+  const double seq_cost = before.cost_params_.MICRO_BLOCK_SEQ_COST;
+  ObOptEstCost::set_cost_scale(1.0, 10.0, 1.0);
+  const ObOptEstCostModel &after = model(ObOptEstCost::NORMAL_MODEL);
+  EXPECT_NE(&before, &after);
+  EXPECT_EQ(seq_cost, before.cost_params_.MICRO_BLOCK_SEQ_COST);
+  EXPECT_DOUBLE_EQ(seq_cost * 10, after.cost_params_.MICRO_BLOCK_SEQ_COST);
+  // the same ratios again publish nothing
+  ObOptEstCost::set_cost_scale(1.0, 10.0, 1.0);
+  EXPECT_EQ(&after, &model(ObOptEstCost::NORMAL_MODEL));
+}
+
+} // end namespace test
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_opt_est_cost_scale.log*");
+  OB_LOGGER.set_file_name("test_opt_est_cost_scale.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -261,4 +261,9 @@ select interval '123123 23:23:23.123123' day (9) to second (9) R from dual;
 select interval '123123 23:23:23.123123' day(9)to second(9) R from dual;
 select interval '12 23:23:23.123123' day to second(6) R from dual;
 select interval '12 23:23:23.123123' day to second R from dual;
-select '\103hh\100hh' 'ueuoiuo';
\ No newline at end of file
+select '\103hh\100hh' 'ueuoiuo';
+select * from t1 where c1 = 'abcdefghijklmnopqrstuvwxyz0123456789' and c2 = 'abcdefghijklmno\'pqrstuvwxyz';
+select * from t1 where c1 in ('0123456789abcdef', '0123456789abcde''f', '0123456789abcdef\\', '0123456789abcdefg\n0123456789abcdefg');
+select /* a long comment which spans more than sixteen bytes * / still comment */ c1 from t1 where c2 = 'x';
+select 'a string literal that is long enough to be scanned in several sixteen byte chunks' 'and continued';
+select "abcdefghijklmnopqrstuvwxyz""abcdefghijklmnopqrstuvwxyz" from dual;
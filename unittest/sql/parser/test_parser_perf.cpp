@@ -10,6 +10,11 @@
  * See the Mulan PubL v2 for more details.
  */
 
+#define private public
+#define protected public
+#include "sql/parser/ob_fast_parser.h"
+#undef private
+#undef protected
 #include "sql/parser/ob_parser.h"
 #include <gtest/gtest.h>
 #include "lib/allocator/page_arena.h"
@@ -138,6 +143,73 @@ void run() {
   std::cout << "====" << "total_cnt:" << pp.total_cnt_ << std::endl;
   std::cout << "====" << "avg_time:" << (double)(pp.total_t_)/(double)(pp.total_cnt_) << std::endl;
 }
+
+// statements whose parse time is spent in string literals
+void build_fast_parser_sql(std::vector<std::string> &sql_array)
+{
+  std::string literal;
+  for (int i = 0; i < 8192; i++) {
+    literal += (0 == i % 1000) ? "\\'" : "x";
+  }
+  sql_array.push_back("select * from t1 where c1 = '" + literal + "';");
+  std::string in_list = "select * from t1 where c1 in (";
+  for (int i = 0; i < 1000; i++) {
+    in_list += (0 == i ? "'" : ", '");
+    in_list += "order_status_value_" + std::to_string(i) + "'";
+  }
+  sql_array.push_back(in_list + ");");
+}
+
+int fast_parse(const std::string &sql, ObIAllocator &allocator, std::string &no_param_sql, int64_t &param_num)
+{
+  char *no_param_sql_ptr = NULL;
+  int64_t no_param_sql_len = 0;
+  ParamList *p_list = NULL;
+  int ret = ObFastParser::parse(ObString::make_string(sql.c_str()), false, no_param_sql_ptr,
+                                no_param_sql_len, p_list, param_num, CS_TYPE_UTF8MB4_GENERAL_CI, allocator);
+  if (OB_SUCC(ret)) {
+    no_param_sql.assign(no_param_sql_ptr, no_param_sql_len);
+  }
+  return ret;
+}
+
+// ObFastParser::parse with the scalar and the sse2 scan of string literals
+int run_fast_parser()
+{
+  int ret = OB_SUCCESS;
+  const int64_t loop_count = 100 * LOOP_COUNT;
+  std::vector<std::string> test_sql_array;
+  build_fast_parser_sql(test_sql_array);
+  ObArenaAllocator allocator(ObModIds::TEST);
+  for (int j = 0; OB_SUCC(ret) && j < (int)test_sql_array.size(); j++) {
+    const std::string &sql = test_sql_array.at(j);
+    std::string no_param_sql[2];
+    int64_t param_num[2] = {0, 0};
+    int64_t total_t[2] = {0, 0};
+    for (int mode = 0; OB_SUCC(ret) && mode < 2; mode++) {
+      ObFastParserBase::ObRawSql::use_sse2_ = (1 == mode);
+      for (int64_t i = 0; OB_SUCC(ret) && i < loop_count; i++) {
+        const int64_t t0 = ObTimeUtility::current_time();
+        ret = fast_parse(sql, allocator, no_param_sql[mode], param_num[mode]);
+        total_t[mode] += ObTimeUtility::current_time() - t0;
+        allocator.reset();
+      }
+    }
+    ObFastParserBase::ObRawSql::use_sse2_ = true;
+    if (OB_FAIL(ret)) {
+      SQL_PC_LOG(ERROR, "fast parse failed", K(ret), K(j));
+    } else if (no_param_sql[0] != no_param_sql[1] || param_num[0] != param_num[1]) {
+      ret = OB_ERR_UNEXPECTED;
+      SQL_PC_LOG(ERROR, "scalar and sse2 results differ", K(ret), K(j), K(param_num[0]), K(param_num[1]));
+    } else {
+      std::cout << "====" << "fast parser sql:" << j << ", len:" << sql.length()
+                << ", param_num:" << param_num[1] << std::endl;
+      std::cout << "====" << "scalar avg_time:" << (double)total_t[0] / (double)loop_count
+                << ", sse2 avg_time:" << (double)total_t[1] / (double)loop_count << std::endl;
+    }
+  }
+  return ret;
+}
 }
 
 int main(int argc, char **argv)
@@ -170,5 +242,5 @@ int main(int argc, char **argv)
     }
   }
   ::test::run();
-  return 0;
+  return OB_SUCCESS == ::test::run_fast_parser() ? 0 : 1;
 }
@@ -107,8 +107,8 @@ void print_stat(std::ostream &of) {
       ObPlanCacheStat &pc_stat = plan_cache->get_plan_cache_stat();
       of << "plan cache stat:" << "plan_count = " << plan_cache->get_plan_num()
                                << ", stmtkey_count = " << plan_cache->get_sql_id_mgr()->get_stmtkey2id_map().size()
-                               << ", access_count = " << pc_stat.access_count_
-                               << ", hit_count_ = " << pc_stat.hit_count_
+                               << ", access_count = " << pc_stat.access_count_.value()
+                               << ", hit_count_ = " << pc_stat.hit_count_.value()
                                << ", memory_used = " << plan_cache->get_mem_used()
                                << std::endl;
 
@@ -0,0 +1,219 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#define private public
+#define protected public
+#include "storage/blocksstable/ob_micro_block_cache.h"
+#include "storage/ob_micro_block_handle_mgr.h"
+#undef private
+#undef protected
+
+namespace oceanbase
+{
+using namespace common;
+using namespace blocksstable;
+using namespace storage;
+namespace unittest
+{
+
+// hands out a handle on a fake io request instead of reading the disk
+class MockDataBlockCache : public ObDataMicroBlockCache
+{
+public:
+  MockDataBlockCache() : io_cnt_(0), req_idx_(0) {}
+  virtual ~MockDataBlockCache() {}
+  virtual int prefetch(
+      const uint64_t tenant_id,
+      const MacroBlockId &macro_id,
+      const ObMicroIndexInfo& idx_row,
+      const ObQueryFlag &flag,
+      const ObTableReadInfo &full_read_info,
+      const ObTabletHandle &tablet_handle,
+      ObMacroBlockHandle &macro_handle) override
+  {
+    UNUSEDx(tenant_id, macro_id, idx_row, flag, full_read_info, tablet_handle);
+    ++io_cnt_;
+    return macro_handle.get_io_handle().set_request(reqs_[req_idx_++ % REQ_CNT]);
+  }
+public:
+  static const int64_t REQ_CNT = 4;
+  int64_t io_cnt_;
+  int64_t req_idx_;
+  ObIORequest reqs_[REQ_CNT];
+};
+
+class TestMicroBlockInflightIO : public ::testing::Test
+{
+public:
+  static const uint64_t TENANT_ID = 1;
+  TestMicroBlockInflightIO() : cache_(nullptr) {}
+  virtual void SetUp() override;
+  virtual void TearDown() override;
+  void make_index_info(const int64_t offset, ObIndexBlockRowHeader &header, ObMicroIndexInfo &idx_row);
+  int scan(const ObMicroIndexInfo &idx_row, ObMicroBlockDataHandle &micro_handle);
+  ObMicroBlockCacheKey make_key(const ObMicroIndexInfo &idx_row)
+  {
+    return ObMicroBlockCacheKey(TENANT_ID, macro_id_, idx_row.get_block_offset(), idx_row.get_block_size());
+  }
+  int64_t slot_idx(const ObMicroBlockCacheKey &key)
+  {
+    return key.hash() % ObDataMicroBlockCache::INFLIGHT_IO_SLOT_CNT;
+  }
+public:
+  MacroBlockId macro_id_;
+  ObQueryFlag query_flag_;
+  ObTableReadInfo read_info_;
+  ObTabletHandle tablet_handle_;
+  MockDataBlockCache *cache_;
+};
+
+void TestMicroBlockInflightIO::SetUp()
+{
+  macro_id_.set_block_index(10);
+  cache_ = OB_NEW(MockDataBlockCache, ObModIds::TEST);
+  ASSERT_NE(nullptr, cache_);
+  for (int64_t i = 0; i < MockDataBlockCache::REQ_CNT; ++i) {
+    // never let a handle release the request, it is not owned by an io manager
+    cache_->reqs_[i].inc_ref();
+  }
+}
+
+void TestMicroBlockInflightIO::TearDown()
+{
+  OB_DELETE(MockDataBlockCache, ObModIds::TEST, cache_);
+  cache_ = nullptr;
+}
+
+void TestMicroBlockInflightIO::make_index_info(
+    const int64_t offset,
+    ObIndexBlockRowHeader &header,
+    ObMicroIndexInfo &idx_row)
+{
+  header.block_offset_ = offset;
+  header.block_size_ = 4096;
+  idx_row.row_header_ = &header;
+}
+
+// what the prefetcher does for a data block missing the cache
+int TestMicroBlockInflightIO::scan(const ObMicroIndexInfo &idx_row, ObMicroBlockDataHandle &micro_handle)
+{
+  int ret = OB_SUCCESS;
+  ObMacroBlockHandle macro_handle;
+  bool is_owner = false;
+  micro_handle.micro_info_.offset_ = idx_row.get_block_offset();
+  micro_handle.micro_info_.size_ = idx_row.get_block_size();
+  if (OB_FAIL(cache_->prefetch_shared(TENANT_ID, macro_id_, idx_row, query_flag_, read_info_,
+                                      tablet_handle_, macro_handle, is_owner))) {
+    STORAGE_LOG(WARN, "prefetch failed", K(ret));
+  } else {
+    micro_handle.tenant_id_ = TENANT_ID;
+    micro_handle.macro_block_id_ = macro_id_;
+    micro_handle.block_state_ = ObSSTableMicroBlockState::IN_BLOCK_IO;
+    micro_handle.io_handle_ = macro_handle;
+    if (is_owner) {
+      micro_handle.inflight_io_cache_ = cache_;
+    }
+  }
+  return ret;
+}
+
+TEST_F(TestMicroBlockInflightIO, same_block_single_io)
+{
+  ObIndexBlockRowHeader header;
+  ObMicroIndexInfo idx_row;
+  make_index_info(0, header, idx_row);
+  ObMicroBlockDataHandle owner;
+  ObMicroBlockDataHandle waiter;
+  ASSERT_EQ(OB_SUCCESS, scan(idx_row, owner));
+  ASSERT_EQ(OB_SUCCESS, scan(idx_row, waiter));
+  EXPECT_EQ(1, cache_->io_cnt_);
+  EXPECT_EQ(cache_, owner.inflight_io_cache_);
+  EXPECT_EQ(nullptr, waiter.inflight_io_cache_);
+  EXPECT_EQ(owner.io_handle_.get_io_handle().req_, waiter.io_handle_.get_io_handle().req_);
+
+  // the owner withdraws the io, the next scan submits its own
+  owner.reset();
+  ObMacroBlockHandle macro_handle;
+  EXPECT_EQ(OB_ENTRY_NOT_EXIST, cache_->get_inflight_io(make_key(idx_row), macro_handle));
+  ObMicroBlockDataHandle other;
+  ASSERT_EQ(OB_SUCCESS, scan(idx_row, other));
+  EXPECT_EQ(2, cache_->io_cnt_);
+}
+
+TEST_F(TestMicroBlockInflightIO, owner_reset_while_waiting)
+{
+  ObIndexBlockRowHeader header;
+  ObMicroIndexInfo idx_row;
+  make_index_info(0, header, idx_row);
+  ObMicroBlockDataHandle owner;
+  ObMicroBlockDataHandle waiter;
+  ASSERT_EQ(OB_SUCCESS, scan(idx_row, owner));
+  ASSERT_EQ(OB_SUCCESS, scan(idx_row, waiter));
+  ObIORequest *req = waiter.io_handle_.get_io_handle().req_;
+  owner.reset();
+  // the waiting scan still holds the io
+  EXPECT_TRUE(waiter.io_handle_.is_valid());
+  EXPECT_EQ(req, waiter.io_handle_.get_io_handle().req_);
+  EXPECT_EQ(1, req->out_ref_cnt_);
+  waiter.reset();
+  EXPECT_EQ(0, req->out_ref_cnt_);
+  ObMacroBlockHandle macro_handle;
+  EXPECT_EQ(OB_ENTRY_NOT_EXIST, cache_->get_inflight_io(make_key(idx_row), macro_handle));
+}
+
+TEST_F(TestMicroBlockInflightIO, collision_replaces_slot)
+{
+  ObIndexBlockRowHeader header;
+  ObMicroIndexInfo idx_row;
+  make_index_info(0, header, idx_row);
+  const ObMicroBlockCacheKey key = make_key(idx_row);
+  ObIndexBlockRowHeader other_header;
+  ObMicroIndexInfo other_row;
+  int64_t offset = 4096;
+  for (; offset < 4096 * 1000000L; offset += 4096) {
+    make_index_info(offset, other_header, other_row);
+    if (slot_idx(make_key(other_row)) == slot_idx(key)) {
+      break;
+    }
+  }
+  const ObMicroBlockCacheKey other_key = make_key(other_row);
+  ASSERT_EQ(slot_idx(key), slot_idx(other_key));
+
+  ObMicroBlockDataHandle owner;
+  ObMicroBlockDataHandle other_owner;
+  ASSERT_EQ(OB_SUCCESS, scan(idx_row, owner));
+  ASSERT_EQ(OB_SUCCESS, scan(other_row, other_owner));
+  EXPECT_EQ(2, cache_->io_cnt_);
+  EXPECT_EQ(cache_, other_owner.inflight_io_cache_);
+  ObMacroBlockHandle macro_handle;
+  EXPECT_EQ(OB_ENTRY_NOT_EXIST, cache_->get_inflight_io(key, macro_handle));
+  // the replaced owner must not withdraw the colliding io
+  owner.reset();
+  ASSERT_EQ(OB_SUCCESS, cache_->get_inflight_io(other_key, macro_handle));
+  EXPECT_EQ(other_owner.io_handle_.get_io_handle().req_, macro_handle.get_io_handle().req_);
+  macro_handle.reset();
+  other_owner.reset();
+  EXPECT_EQ(OB_ENTRY_NOT_EXIST, cache_->get_inflight_io(other_key, macro_handle));
+}
+
+} // end namespace unittest
+} // end namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_micro_block_inflight_io.log*");
+  OB_LOGGER.set_file_name("test_micro_block_inflight_io.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -455,20 +455,34 @@ TEST_F(TestIOStruct, IOStat)
   double avg_iops = 0;
   double avg_size = 0;
   double avg_rt = 0;
+  double p99_rt = 0;
   double avg_cpu = 0;
-  io_diff.diff(stat, avg_iops, avg_size, avg_rt);
+  io_diff.diff(stat, avg_iops, avg_size, avg_rt, p99_rt);
   cpu_diff.get_cpu_usage(avg_cpu);
 //  ASSERT_DOUBLE_EQ(avg_iops, 0);
   ASSERT_DOUBLE_EQ(avg_size, 2);
   ASSERT_DOUBLE_EQ(avg_rt, 3);
+  // 100 io of 3us each, not one io of 300us
+  ASSERT_DOUBLE_EQ(p99_rt, 4);
   ASSERT_DOUBLE_EQ(avg_cpu, 0);
 
   usleep(1000L * 1000L); // sleep 1s
   stat.accumulate(200, 600, 4000);
-  io_diff.diff(stat, avg_iops, avg_size, avg_rt);
+  io_diff.diff(stat, avg_iops, avg_size, avg_rt, p99_rt);
   ASSERT_NEAR(avg_iops, 200, 1);
   ASSERT_NEAR(avg_size, 3, 0.1);
   ASSERT_NEAR(avg_rt, 20, 0.1);
+  ASSERT_DOUBLE_EQ(p99_rt, 32);
+
+  // only io of the last period counts
+  for (int64_t i = 0; i < 99; ++i) {
+    stat.accumulate(1, 4096, 100);
+  }
+  stat.accumulate(1, 4096, 10000);
+  io_diff.diff(stat, avg_iops, avg_size, avg_rt, p99_rt);
+  ASSERT_DOUBLE_EQ(p99_rt, 128);
+  ASSERT_EQ(ObIOStat::RT_HIST_BUCKET_CNT - 1, ObIOStat::get_rt_bucket(UINT64_MAX));
+  ASSERT_EQ(0, ObIOStat::get_rt_bucket(0));
   ASSERT_GE(avg_cpu, 0);
 }
 
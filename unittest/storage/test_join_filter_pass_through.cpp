@@ -0,0 +1,129 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#define private public
+#define protected public
+#include "storage/access/ob_block_row_store.h"
+#include "storage/access/ob_table_access_context.h"
+#include "storage/blocksstable/ob_micro_block_row_scanner.h"
+#include "sql/engine/basic/ob_pushdown_filter.h"
+#include "sql/engine/expr/ob_expr_join_filter.h"
+#include "sql/engine/px/ob_px_bloom_filter.h"
+#include "sql/engine/ob_exec_context.h"
+#undef private
+#undef protected
+
+namespace oceanbase
+{
+using namespace common;
+using namespace blocksstable;
+using namespace storage;
+using namespace sql;
+namespace unittest
+{
+
+class TestJoinFilterPassThrough : public ::testing::Test
+{
+public:
+  static const int64_t ROW_CNT = 100;
+  TestJoinFilterPassThrough()
+    : exec_ctx_(allocator_),
+      eval_ctx_(exec_ctx_),
+      expr_spec_(allocator_),
+      op_(eval_ctx_, expr_spec_),
+      filter_node_(allocator_),
+      join_filter_ctx_(nullptr),
+      executor_(allocator_, filter_node_, op_),
+      block_row_store_(access_ctx_),
+      micro_scanner_(allocator_)
+  {}
+  virtual void SetUp() override;
+public:
+  ObArenaAllocator allocator_;
+  ObExecContext exec_ctx_;
+  ObEvalCtx eval_ctx_;
+  ObPushdownExprSpec expr_spec_;
+  ObPushdownOperator op_;
+  ObPushdownBlackFilterNode filter_node_;
+  ObExpr join_filter_expr_;
+  ObExprJoinFilter::ObExprJoinFilterContext *join_filter_ctx_;
+  ObBlackFilterExecutor executor_;
+  ObTableAccessContext access_ctx_;
+  ObBlockRowStore block_row_store_;
+  // never inited, any attempt to decode the micro block fails
+  ObMicroBlockRowScanner micro_scanner_;
+};
+
+void TestJoinFilterPassThrough::SetUp()
+{
+  ASSERT_EQ(OB_SUCCESS, exec_ctx_.init_expr_op(1));
+  ASSERT_EQ(OB_SUCCESS, exec_ctx_.create_expr_op_ctx(0, join_filter_ctx_));
+  ASSERT_NE(nullptr, join_filter_ctx_);
+  join_filter_ctx_->bf_key_.init(1, 1, 1, 1);
+  join_filter_expr_.type_ = T_OP_JOIN_BLOOM_FILTER;
+  join_filter_expr_.expr_ctx_id_ = 0;
+  ASSERT_EQ(OB_SUCCESS, filter_node_.filter_exprs_.init(1));
+  ASSERT_EQ(OB_SUCCESS, filter_node_.filter_exprs_.push_back(&join_filter_expr_));
+}
+
+TEST_F(TestJoinFilterPassThrough, not_ready_filter_skips_decoding)
+{
+  ASSERT_EQ(OB_SUCCESS, block_row_store_.filter_micro_block(ROW_CNT, micro_scanner_, nullptr, &executor_));
+  ASSERT_NE(nullptr, executor_.get_result());
+  EXPECT_TRUE(executor_.get_result()->is_all_true());
+  EXPECT_EQ(ROW_CNT, executor_.get_result()->size());
+  // rows let pass by storage are counted as seen by the filter
+  EXPECT_EQ(ROW_CNT, join_filter_ctx_->total_count_);
+  EXPECT_EQ(0, join_filter_ctx_->check_count_);
+  EXPECT_EQ(0, join_filter_ctx_->filter_count_);
+}
+
+TEST_F(TestJoinFilterPassThrough, filter_probed_every_check_times)
+{
+  ObPxBloomFilterManager &mgr = ObPxBloomFilterManager::instance();
+  ASSERT_EQ(OB_SUCCESS, mgr.init());
+  ASSERT_TRUE(executor_.is_pass_through(ROW_CNT));
+  // published after the first probe
+  ObPxBloomFilter bloom_filter;
+  bloom_filter.px_bf_recieve_count_ = 1;
+  bloom_filter.px_bf_recieve_size_ = 1;
+  ASSERT_TRUE(bloom_filter.check_ready());
+  ASSERT_EQ(OB_SUCCESS, mgr.set_px_bloom_filter(join_filter_ctx_->bf_key_, &bloom_filter));
+  int64_t blocks = 1;
+  for (; blocks <= ObExprJoinFilter::CHECK_TIMES; blocks++) {
+    ASSERT_TRUE(executor_.is_pass_through(ROW_CNT));
+    ASSERT_EQ(nullptr, join_filter_ctx_->bloom_filter_ptr_);
+  }
+  EXPECT_EQ(blocks * ROW_CNT, join_filter_ctx_->total_count_);
+  // the next probe finds the ready filter, the rows of this block are evaluated by it
+  EXPECT_FALSE(executor_.is_pass_through(ROW_CNT));
+  EXPECT_EQ(&bloom_filter, join_filter_ctx_->bloom_filter_ptr_);
+  EXPECT_TRUE(join_filter_ctx_->is_ready_);
+  EXPECT_EQ(blocks * ROW_CNT, join_filter_ctx_->total_count_);
+  EXPECT_FALSE(executor_.is_pass_through(ROW_CNT));
+  ObPxBloomFilter *erased = nullptr;
+  ASSERT_EQ(OB_SUCCESS, mgr.erase_px_bloom_filter(join_filter_ctx_->bf_key_, erased));
+  mgr.destroy();
+}
+
+} // end namespace unittest
+} // end namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_join_filter_pass_through.log*");
+  OB_LOGGER.set_file_name("test_join_filter_pass_through.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
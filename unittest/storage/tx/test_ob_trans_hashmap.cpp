@@ -12,8 +12,11 @@
 
 #include "storage/tx/ob_trans_hashmap.h"
 #include <gtest/gtest.h>
+#include <thread>
+#include <vector>
 #include "share/ob_errno.h"
 #include "lib/oblog/ob_log.h"
+#include "lib/time/ob_time_utility.h"
 #include "storage/tx/ob_trans_define.h"
 
 namespace oceanbase
@@ -66,15 +69,23 @@ class ObTransTestValueAlloc
 public:
   ObTransTestValue *alloc_value() {
     // for example
-    return op_alloc(ObTransTestValue);
+    ObTransTestValue *val = op_alloc(ObTransTestValue);
+    if (NULL != val) {
+      ATOMIC_INC(&alloc_cnt_);
+    }
+    return val;
   }
   void free_value(ObTransTestValue * val) {
     // for example
     if (NULL != val) {
       op_free(val);
+      ATOMIC_DEC(&alloc_cnt_);
     }
   }
+  int64_t get_alloc_cnt() const { return ATOMIC_LOAD(&alloc_cnt_); }
+  static int64_t alloc_cnt_;
 };
+int64_t ObTransTestValueAlloc::alloc_cnt_ = 0;
 
 typedef ObTransHashMap<ObTransID, ObTransTestValue, ObTransTestValueAlloc, common::SpinRWLock> TestHashMap;
 
@@ -166,6 +177,161 @@ TEST_F(TestObTrans, hashmap_init_invalid)
   EXPECT_EQ(0, map.count());
 }
 
+TEST_F(TestObTrans, hashmap_concurrent_get_perf)
+{
+  TRANS_LOG(INFO, "called", "func", test_info_->name());
+
+  static const int64_t HOT_KEY_CNT = 16;
+  static const int64_t READER_CNT = 8;
+  static const int64_t GET_CNT_PER_READER = 1000000;
+  static const int64_t WRITER_LOOP_CNT = 100000;
+
+  TestHashMap map;
+  EXPECT_EQ(OB_SUCCESS, map.init(lib::ObMemAttr(OB_SERVER_TENANT_ID, "TestObTrans")));
+
+  // hot keys are always in the map, readers must never miss them
+  ObTransID hot_ids[HOT_KEY_CNT];
+  for (int64_t i = 0; i < HOT_KEY_CNT; ++i) {
+    ObTransTestValue *val = NULL;
+    hot_ids[i] = ObTransID(i + 1);
+    EXPECT_EQ(OB_SUCCESS, map.alloc_value(val));
+    EXPECT_EQ(OB_SUCCESS, val->init(hot_ids[i]));
+    EXPECT_EQ(OB_SUCCESS, map.insert(hot_ids[i], val));
+  }
+
+  int64_t miss_cnt = 0;
+  bool stop = false;
+  // writer keeps inserting and deleting cold keys which share buckets with hot keys
+  std::thread writer([&]() {
+    for (int64_t i = 0; i < WRITER_LOOP_CNT && !ATOMIC_LOAD(&stop); ++i) {
+      ObTransTestValue *val = NULL;
+      ObTransID cold_id(HOT_KEY_CNT + 1 + i);
+      if (OB_SUCCESS == map.alloc_value(val)) {
+        val->init(cold_id);
+        if (OB_SUCCESS == map.insert(cold_id, val)) {
+          map.del(cold_id, val);
+        } else {
+          map.free_value(val);
+        }
+      }
+    }
+  });
+
+  const int64_t begin_ts = ObTimeUtility::current_time();
+  std::vector<std::thread> readers;
+  for (int64_t t = 0; t < READER_CNT; ++t) {
+    readers.push_back(std::thread([&, t]() {
+      for (int64_t i = 0; i < GET_CNT_PER_READER; ++i) {
+        ObTransTestValue *val = NULL;
+        const ObTransID &id = hot_ids[(i + t) % HOT_KEY_CNT];
+        if (OB_SUCCESS != map.get(id, val)) {
+          ATOMIC_INC(&miss_cnt);
+        } else {
+          map.revert(val);
+        }
+      }
+    }));
+  }
+  for (int64_t t = 0; t < READER_CNT; ++t) {
+    readers.at(t).join();
+  }
+  const int64_t elapsed_us = ObTimeUtility::current_time() - begin_ts;
+  ATOMIC_STORE(&stop, true);
+  writer.join();
+
+  TRANS_LOG(INFO, "concurrent get perf", K(READER_CNT), K(GET_CNT_PER_READER), K(elapsed_us),
+            "get_per_sec", READER_CNT * GET_CNT_PER_READER * 1000000 / MAX(1, elapsed_us));
+  EXPECT_EQ(0, miss_cnt);
+  EXPECT_EQ(HOT_KEY_CNT, map.count());
+
+  RemoveFunctor remove_if_fn;
+  map.remove_if(remove_if_fn);
+  EXPECT_EQ(0, map.count());
+}
+
+TEST_F(TestObTrans, hashmap_concurrent_get_del_reclaim)
+{
+  TRANS_LOG(INFO, "called", "func", test_info_->name());
+
+  static const int64_t KEY_CNT = 64;
+  static const int64_t READER_CNT = 4;
+  static const int64_t LOOP_CNT = 20000;
+
+  const int64_t base_alloc_cnt = ObTransTestValueAlloc::alloc_cnt_;
+  TestHashMap map;
+  EXPECT_EQ(OB_SUCCESS, map.init(lib::ObMemAttr(OB_SERVER_TENANT_ID, "TestObTrans")));
+
+  bool stop = false;
+  // readers get the keys which the writer keeps inserting and deleting, the
+  // values they hold or walk through must not be freed under them
+  std::vector<std::thread> readers;
+  for (int64_t t = 0; t < READER_CNT; ++t) {
+    readers.push_back(std::thread([&, t]() {
+      int64_t i = t;
+      while (!ATOMIC_LOAD(&stop)) {
+        ObTransTestValue *val = NULL;
+        const ObTransID id((i++ % KEY_CNT) + 1);
+        if (OB_SUCCESS == map.get(id, val)) {
+          EXPECT_EQ(id, val->get_trans_id());
+          map.revert(val);
+        }
+      }
+    }));
+  }
+  for (int64_t i = 0; i < LOOP_CNT; ++i) {
+    ObTransTestValue *val = NULL;
+    const ObTransID id((i % KEY_CNT) + 1);
+    if (OB_SUCCESS == map.alloc_value(val)) {
+      val->init(id);
+      if (OB_SUCCESS == map.insert(id, val)) {
+        map.del(id, val);
+      } else {
+        map.free_value(val);
+      }
+    }
+  }
+  ATOMIC_STORE(&stop, true);
+  for (int64_t t = 0; t < READER_CNT; ++t) {
+    readers.at(t).join();
+  }
+  EXPECT_EQ(0, map.count());
+
+  // the retired values are all freed once the map is reset
+  map.reset();
+  EXPECT_EQ(base_alloc_cnt, ObTransTestValueAlloc::alloc_cnt_);
+}
+
+TEST_F(TestObTrans, hashmap_reclaim_retired)
+{
+  TRANS_LOG(INFO, "called", "func", test_info_->name());
+
+  const int64_t base_alloc_cnt = ObTransTestValueAlloc::alloc_cnt_;
+  const int64_t batch_cnt = TestHashMap::RECLAIM_BATCH_CNT;
+  TestHashMap map;
+  EXPECT_EQ(OB_SUCCESS, map.init(lib::ObMemAttr(OB_SERVER_TENANT_ID, "TestObTrans")));
+  // fewer deletes than a reclaim batch, the values stay retired
+  for (int64_t i = 1; i < batch_cnt; ++i) {
+    ObTransTestValue *val = NULL;
+    const ObTransID id(i);
+    ASSERT_EQ(OB_SUCCESS, map.alloc_value(val));
+    val->init(id);
+    ASSERT_EQ(OB_SUCCESS, map.insert(id, val));
+    ASSERT_EQ(OB_SUCCESS, map.del(id, val));
+  }
+  EXPECT_EQ(0, map.count());
+  EXPECT_EQ(base_alloc_cnt + batch_cnt - 1, ObTransTestValueAlloc::alloc_cnt_);
+
+  // gets of a busy map do not pay for the reclaim
+  ObTransTestValue *val = NULL;
+  EXPECT_EQ(OB_ENTRY_NOT_EXIST, map.get(ObTransID(1), val));
+  EXPECT_EQ(base_alloc_cnt + batch_cnt - 1, ObTransTestValueAlloc::alloc_cnt_);
+
+  // as relied on by ObTxDescMgr::wait before it counts the allocated values
+  map.reclaim_retired();
+  EXPECT_EQ(base_alloc_cnt, ObTransTestValueAlloc::alloc_cnt_);
+  map.reset();
+}
+
 }//end of unittest
 }//end of oceanbase
 
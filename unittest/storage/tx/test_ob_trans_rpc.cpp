@@ -12,12 +12,15 @@
 
 #include "storage/tx/ob_trans_rpc.h"
 #include <gtest/gtest.h>
+#include <sys/resource.h>
 #include "share/ob_errno.h"
 #include "lib/oblog/ob_log.h"
 #include "common/ob_clock_generator.h"
 #include "share/ob_common_rpc_proxy.h"
 #include "lib/container/ob_array_iterator.h"
 #include "storage/tx/ob_trans_service.h"
+#include "storage/tx/ob_trans_end_trans_callback.h"
+#include "storage/tx/ob_trans_factory.h"
 
 namespace oceanbase
 {
@@ -97,6 +100,87 @@ TEST_F(TestObTransRpc, trans_rpc_init_invalid_args)
   rpc.destroy();
 }
 
+// a commit callback waiting for gts must not hold up the ready ones queued behind it
+TEST_F(TestObTransRpc, commit_cb_task_not_blocked_by_waiting_one)
+{
+  TRANS_LOG(INFO, "called", "func", test_info_->name());
+  const int64_t WAIT_US = 2 * 1000 * 1000;
+  ObTransService *cb_service = new ObTransService();
+  ObTxCommitCallback cb;
+  EXPECT_EQ(OB_SUCCESS, cb_service->ObSimpleThreadPool::init(1, 64, "TxCbTest"));
+  const int64_t base_release_cnt = ObTxCommitCallbackTaskFactory::get_release_count();
+
+  ObTxCommitCallbackTask *waiting_task = ObTxCommitCallbackTaskFactory::alloc();
+  ASSERT_TRUE(NULL != waiting_task);
+  EXPECT_EQ(OB_SUCCESS, waiting_task->make(ObTransRetryTaskType::END_TRANS_CB_TASK,
+                                           cb, MonotonicTs::current_time(), WAIT_US));
+  EXPECT_EQ(OB_SUCCESS, cb_service->push(waiting_task));
+
+  // released right after its callback, so the release count tells it is handled
+  ObTxCommitCallbackTask *ready_task = ObTxCommitCallbackTaskFactory::alloc();
+  ASSERT_TRUE(NULL != ready_task);
+  EXPECT_EQ(OB_SUCCESS, ready_task->make(ObTransRetryTaskType::END_TRANS_CB_TASK,
+                                         cb, MonotonicTs::current_time(), 0));
+  const int64_t push_ts = ObTimeUtility::current_time();
+  EXPECT_EQ(OB_SUCCESS, cb_service->push(ready_task));
+  while (base_release_cnt == ObTxCommitCallbackTaskFactory::get_release_count()
+         && ObTimeUtility::current_time() - push_ts < WAIT_US) {
+    ob_usleep(1000);
+  }
+  const int64_t handle_us = ObTimeUtility::current_time() - push_ts;
+  TRANS_LOG(INFO, "ready commit callback handled", K(handle_us));
+  EXPECT_EQ(base_release_cnt + 1, ObTxCommitCallbackTaskFactory::get_release_count());
+  EXPECT_LT(handle_us, WAIT_US / 2);
+
+  // the waiting one is handled once gts elapses
+  while (base_release_cnt + 1 == ObTxCommitCallbackTaskFactory::get_release_count()
+         && ObTimeUtility::current_time() - push_ts < 2 * WAIT_US) {
+    ob_usleep(1000);
+  }
+  EXPECT_EQ(base_release_cnt + 2, ObTxCommitCallbackTaskFactory::get_release_count());
+  cb_service->ObSimpleThreadPool::destroy();
+  delete cb_service;
+}
+
+// commit callbacks all waiting for gts must not keep the thread spinning
+TEST_F(TestObTransRpc, waiting_commit_cb_tasks_back_off)
+{
+  TRANS_LOG(INFO, "called", "func", test_info_->name());
+  const int64_t WAIT_US = 500 * 1000;
+  const int64_t TASK_CNT = 4;
+  ObTransService *cb_service = new ObTransService();
+  ObTxCommitCallback cb;
+  EXPECT_EQ(OB_SUCCESS, cb_service->ObSimpleThreadPool::init(1, 64, "TxCbTest"));
+  const int64_t base_release_cnt = ObTxCommitCallbackTaskFactory::get_release_count();
+  struct rusage start_usage;
+  struct rusage end_usage;
+  ASSERT_EQ(0, getrusage(RUSAGE_SELF, &start_usage));
+  const int64_t push_ts = ObTimeUtility::current_time();
+  for (int64_t i = 0; i < TASK_CNT; ++i) {
+    ObTxCommitCallbackTask *task = ObTxCommitCallbackTaskFactory::alloc();
+    ASSERT_TRUE(NULL != task);
+    EXPECT_EQ(OB_SUCCESS, task->make(ObTransRetryTaskType::END_TRANS_CB_TASK,
+                                     cb, MonotonicTs::current_time(), WAIT_US));
+    EXPECT_EQ(OB_SUCCESS, cb_service->push(task));
+  }
+  while (base_release_cnt + TASK_CNT != ObTxCommitCallbackTaskFactory::get_release_count()
+         && ObTimeUtility::current_time() - push_ts < 4 * WAIT_US) {
+    ob_usleep(1000);
+  }
+  ASSERT_EQ(0, getrusage(RUSAGE_SELF, &end_usage));
+  EXPECT_EQ(base_release_cnt + TASK_CNT, ObTxCommitCallbackTaskFactory::get_release_count());
+  const int64_t cpu_us =
+      (end_usage.ru_utime.tv_sec - start_usage.ru_utime.tv_sec) * 1000000
+      + (end_usage.ru_utime.tv_usec - start_usage.ru_utime.tv_usec)
+      + (end_usage.ru_stime.tv_sec - start_usage.ru_stime.tv_sec) * 1000000
+      + (end_usage.ru_stime.tv_usec - start_usage.ru_stime.tv_usec);
+  TRANS_LOG(INFO, "waiting commit callbacks handled", K(cpu_us));
+  // a spinning thread burns about the whole wait
+  EXPECT_LT(cpu_us, WAIT_US / 2);
+  cb_service->ObSimpleThreadPool::destroy();
+  delete cb_service;
+}
+
 }//end of unittest
 }//end of oceanbase
 